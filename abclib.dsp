@@ -1847,6 +1847,14 @@ SOURCE=.\src\sat\csat\csat_apis.h
 # PROP Default_Filter ""
 # Begin Source File
 
+SOURCE=.\src\sat\bsat\satBackend.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\sat\bsat\satBackend.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bsat\satClause.h
 # End Source File
 # Begin Source File
@@ -5911,6 +5919,10 @@ SOURCE=.\src\aig\gia\giaIiff.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaImage.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaIso.c
 # End Source File
 # Begin Source File
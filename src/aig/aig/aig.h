@@ -174,6 +174,10 @@ struct Aig_Man_t_
   //-- jlong -- end
 };
 
+// processes the nodes [iBeg, iEnd) of a level in thread iThread (see Aig_ManLevelRunPar)
+typedef void (*Aig_RangeFunc_t)( void * pData, int iThread, int iBeg, int iEnd );
+#define AIG_LEVEL_PAR_MIN 100 // the min number of nodes per thread to divide a level
+
 // cut computation
 typedef struct Aig_ManCut_t_         Aig_ManCut_t;
 typedef struct Aig_Cut_t_            Aig_Cut_t;
@@ -229,6 +233,7 @@ static inline Aig_Cut_t *  Aig_CutNext( Aig_Cut_t * pCut )              { return
 ////////////////////////////////////////////////////////////////////////
 
 static inline unsigned     Aig_ObjCutSign( unsigned ObjId )       { return (1U << (ObjId & 31));                            }
+static inline int          Aig_RangeSplit( int iBeg, int iEnd, int t, int nThreads ) { return iBeg + (int)((ABC_INT64_T)(iEnd - iBeg) * t / nThreads); }
 static inline int          Aig_WordCountOnes( unsigned uWord )
 {
     uWord = (uWord & 0x55555555) + ((uWord>>1) & 0x55555555);
@@ -472,6 +477,8 @@ extern Vec_Ptr_t *     Aig_ManDfs( Aig_Man_t * p, int fNodesOnly );
 extern Vec_Ptr_t *     Aig_ManDfsAll( Aig_Man_t * p );
 extern Vec_Ptr_t *     Aig_ManDfsPreorder( Aig_Man_t * p, int fNodesOnly );
 extern Vec_Vec_t *     Aig_ManLevelize( Aig_Man_t * p );
+extern Vec_Int_t *     Aig_ManLevelizeNodes( Aig_Man_t * p, Vec_Int_t ** pvStarts );
+extern void            Aig_ManLevelRunPar( Vec_Int_t * vStarts, int nThreads, int nMinPerThread, Aig_RangeFunc_t pFunc, void * pData );
 extern Vec_Ptr_t *     Aig_ManDfsNodes( Aig_Man_t * p, Aig_Obj_t ** ppNodes, int nNodes );
 extern Vec_Ptr_t *     Aig_ManDfsChoices( Aig_Man_t * p );
 extern Vec_Ptr_t *     Aig_ManDfsReverse( Aig_Man_t * p );
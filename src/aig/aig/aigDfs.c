@@ -333,6 +333,133 @@ Vec_Vec_t * Aig_ManLevelize( Aig_Man_t * p )
     return vLevels;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Orders the internal nodes by level.]
+
+  Description [Returns the IDs of the internal nodes sorted by level.
+  The levels are recomputed from the fanins (looking through the buffers),
+  so the result does not depend on the levels stored in the objects.
+  The nodes of level k (k >= 1) are in the range [vStarts[k], vStarts[k+1]),
+  where vStarts is returned in *pvStarts.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Aig_ManLevelizeNodes( Aig_Man_t * p, Vec_Int_t ** pvStarts )
+{
+    Vec_Int_t * vLevels, * vStarts, * vNodes;
+    Aig_Obj_t * pObj;
+    int i, Level, nLevels = 0;
+    // compute the levels in the topological order
+    vLevels = Vec_IntStart( Aig_ManObjNumMax(p) );
+    Aig_ManForEachObj( p, pObj, i )
+    {
+        if ( Aig_ObjIsBuf(pObj) )
+            Level = Vec_IntEntry( vLevels, Aig_ObjFaninId0(pObj) );
+        else if ( Aig_ObjIsNode(pObj) )
+            Level = 1 + Abc_MaxInt( Vec_IntEntry(vLevels, Aig_ObjFaninId0(pObj)), Vec_IntEntry(vLevels, Aig_ObjFaninId1(pObj)) );
+        else
+            continue;
+        Vec_IntWriteEntry( vLevels, i, Level );
+        nLevels = Abc_MaxInt( nLevels, Level );
+    }
+    // find the first position of each level
+    vStarts = Vec_IntStart( nLevels + 2 );
+    Aig_ManForEachNode( p, pObj, i )
+        Vec_IntAddToEntry( vStarts, Vec_IntEntry(vLevels, i) + 1, 1 );
+    for ( i = 1; i <= nLevels + 1; i++ )
+        Vec_IntAddToEntry( vStarts, i, Vec_IntEntry(vStarts, i-1) );
+    // place the nodes
+    vNodes = Vec_IntStart( Aig_ManNodeNum(p) );
+    Aig_ManForEachNode( p, pObj, i )
+    {
+        Level = Vec_IntEntry( vLevels, i );
+        Vec_IntWriteEntry( vNodes, Vec_IntEntry(vStarts, Level), i );
+        Vec_IntAddToEntry( vStarts, Level, 1 );
+    }
+    // restore the starts
+    for ( i = nLevels + 1; i > 0; i-- )
+        Vec_IntWriteEntry( vStarts, i, Vec_IntEntry(vStarts, i-1) );
+    Vec_IntWriteEntry( vStarts, 0, 0 );
+    assert( Vec_IntEntryLast(vStarts) == Aig_ManNodeNum(p) );
+    Vec_IntFree( vLevels );
+    *pvStarts = vStarts;
+    return vNodes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the ranges of nodes one after another using several threads.]
+
+  Description [The ranges are [vStarts[k], vStarts[k+1]), for example,
+  the levels returned by Aig_ManLevelizeNodes(). Each range is finished
+  before the next one is started. A range with at least nMinPerThread 
+  nodes per thread is divided into nThreads parts (see Aig_RangeSplit()),
+  which are processed at the same time by calling pFunc with the thread
+  numbers 0, 1, ..., nThreads-1. A smaller range is processed by calling 
+  pFunc with thread number 0 in the calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Aig_RangeTask_t_ Aig_RangeTask_t;
+struct Aig_RangeTask_t_
+{
+    Aig_RangeFunc_t  pFunc;          // the function processing the range
+    void *           pData;          // the data of the caller
+    int              iThread;        // the thread number given to the function
+    int              iBeg;           // the first node of this task
+    int              iEnd;           // the node following the last node
+};
+static int Aig_ManLevelRunTask( void * pArg )
+{
+    Aig_RangeTask_t * pTask = (Aig_RangeTask_t *)pArg;
+    pTask->pFunc( pTask->pData, pTask->iThread, pTask->iBeg, pTask->iEnd );
+    return 0;
+}
+void Aig_ManLevelRunPar( Vec_Int_t * vStarts, int nThreads, int nMinPerThread, Aig_RangeFunc_t pFunc, void * pData )
+{
+    Aig_RangeTask_t * pTasks;
+    Util_Sched_t * pSched = NULL;
+    int k, t, iBeg, iEnd;
+    pTasks = ABC_CALLOC( Aig_RangeTask_t, nThreads );
+    for ( t = 0; t < nThreads; t++ )
+    {
+        pTasks[t].pFunc   = pFunc;
+        pTasks[t].pData   = pData;
+        pTasks[t].iThread = t;
+    }
+    for ( k = 0; k + 1 < Vec_IntSize(vStarts); k++ )
+    {
+        iBeg = Vec_IntEntry( vStarts, k );
+        iEnd = Vec_IntEntry( vStarts, k+1 );
+        if ( iBeg == iEnd )
+            continue;
+        if ( nThreads <= 1 || iEnd - iBeg < nMinPerThread * nThreads )
+        {
+            pFunc( pData, 0, iBeg, iEnd );
+            continue;
+        }
+        if ( pSched == NULL )
+            pSched = Util_SchedStart( nThreads );
+        for ( t = 0; t < nThreads; t++ )
+        {
+            pTasks[t].iBeg = Aig_RangeSplit( iBeg, iEnd, t,   nThreads );
+            pTasks[t].iEnd = Aig_RangeSplit( iBeg, iEnd, t+1, nThreads );
+            Util_SchedSubmit( pSched, Aig_ManLevelRunTask, pTasks + t );
+        }
+        Util_SchedWaitAll( pSched );
+    }
+    if ( pSched )
+        Util_SchedStop( pSched );
+    ABC_FREE( pTasks );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Collects internal nodes and PIs in the DFS order.]
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "aig.h"
+#include "misc/mem/mem.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -106,6 +107,7 @@ Aig_MmFixed_t * Aig_MmFixedStart( int nEntrySize, int nEntriesMax )
     p->pEntriesFree  = NULL;
 
     p->nChunkSize = nEntriesMax / 8;
+    p->nChunkSize = Mem_ChunkSize( p->nChunkSize * nEntrySize ) / nEntrySize;
     if ( p->nChunkSize < 8 )
         p->nChunkSize = 8;
 
@@ -142,7 +144,7 @@ void Aig_MmFixedStop( Aig_MmFixed_t * p, int fVerbose )
             p->nEntriesUsed, p->nEntriesMax, p->nEntrySize * p->nEntriesUsed, p->nMemoryAlloc );
     }
     for ( i = 0; i < p->nChunks; i++ )
-        ABC_FREE( p->pChunks[i] );
+        Mem_ChunkFree( p->pChunks[i] );
     ABC_FREE( p->pChunks );
     ABC_FREE( p );
 }
@@ -172,7 +174,7 @@ char * Aig_MmFixedEntryFetch( Aig_MmFixed_t * p )
             p->nChunksAlloc *= 2;
             p->pChunks = ABC_REALLOC( char *, p->pChunks, p->nChunksAlloc ); 
         }
-        p->pEntriesFree = ABC_ALLOC( char, p->nEntrySize * p->nChunkSize );
+        p->pEntriesFree = Mem_ChunkAlloc( (size_t)p->nEntrySize * p->nChunkSize );
         p->nMemoryAlloc += p->nEntrySize * p->nChunkSize;
         // transform these entries into a linked list
         pTemp = p->pEntriesFree;
@@ -237,7 +239,7 @@ void Aig_MmFixedRestart( Aig_MmFixed_t * p )
         return;
     // deallocate all chunks except the first one
     for ( i = 1; i < p->nChunks; i++ )
-        ABC_FREE( p->pChunks[i] );
+        Mem_ChunkFree( p->pChunks[i] );
     p->nChunks = 1;
     // transform these entries into a linked list
     pTemp = p->pChunks[0];
@@ -313,7 +315,7 @@ Aig_MmFlex_t * Aig_MmFlexStart()
     p->pCurrent      = NULL;
     p->pEnd          = NULL;
 
-    p->nChunkSize    = (1 << 18);
+    p->nChunkSize    = Mem_ChunkSize( (1 << 18) );
     p->nChunksAlloc  = 64;
     p->nChunks       = 0;
     p->pChunks       = ABC_ALLOC( char *, p->nChunksAlloc );
@@ -347,7 +349,7 @@ void Aig_MmFlexStop( Aig_MmFlex_t * p, int fVerbose )
             p->nEntriesUsed, p->nMemoryUsed, p->nMemoryAlloc );
     }
     for ( i = 0; i < p->nChunks; i++ )
-        ABC_FREE( p->pChunks[i] );
+        Mem_ChunkFree( p->pChunks[i] );
     ABC_FREE( p->pChunks );
     ABC_FREE( p );
 }
@@ -384,7 +386,7 @@ char * Aig_MmFlexEntryFetch( Aig_MmFlex_t * p, int nBytes )
             // (ideally, this should never happen)
             p->nChunkSize = 2 * nBytes;
         }
-        p->pCurrent = ABC_ALLOC( char, p->nChunkSize );
+        p->pCurrent = Mem_ChunkAlloc( p->nChunkSize );
         p->pEnd     = p->pCurrent + p->nChunkSize;
         p->nMemoryAlloc += p->nChunkSize;
         // add the chunk to the chunk storage
@@ -419,7 +421,7 @@ void Aig_MmFlexRestart( Aig_MmFlex_t * p )
         return;
     // deallocate all chunks except the first one
     for ( i = 1; i < p->nChunks; i++ )
-        ABC_FREE( p->pChunks[i] );
+        Mem_ChunkFree( p->pChunks[i] );
     p->nChunks  = 1;
     p->nMemoryAlloc = p->nChunkSize;
     // transform these entries into a linked list
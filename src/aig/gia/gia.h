@@ -42,8 +42,18 @@
 
 ABC_NAMESPACE_HEADER_START
 
-#define GIA_NONE 0x1FFFFFFF
-#define GIA_VOID 0x0FFFFFFF
+// by default, an object takes 12 bytes and the number of objects is limited by 2^29;
+// when compiled with ABC_USE_LARGE_GIA, an object takes 16 bytes and the number of
+// objects is limited by 2^30-1 (the largest number whose literals still fit into int)
+#ifdef ABC_USE_LARGE_GIA
+#define GIA_NONE    0x3FFFFFFF
+#define GIA_VOID    0x3FFFFFFF
+#define GIA_OBJ_MAX 0x3FFFFFFF
+#else
+#define GIA_NONE    0x1FFFFFFF
+#define GIA_VOID    0x0FFFFFFF
+#define GIA_OBJ_MAX (1 << 29)
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -57,7 +67,12 @@ typedef struct Gia_Dat_t_            Gia_Dat_t;
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
 {
+#ifdef ABC_USE_LARGE_GIA
+    unsigned       iRepr   : 30;  // representative node
+    unsigned       fUnused :  2;  // unused
+#else
     unsigned       iRepr   : 28;  // representative node
+#endif
     unsigned       fProved :  1;  // marks the proved equivalence
     unsigned       fFailed :  1;  // marks the failed equivalence
     unsigned       fColorA :  1;  // marks cone of A
@@ -76,6 +91,19 @@ struct Gia_Plc_t_
 typedef struct Gia_Obj_t_ Gia_Obj_t;
 struct Gia_Obj_t_
 {
+#ifdef ABC_USE_LARGE_GIA
+    unsigned       iDiff0 :  30;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+    unsigned       fMark0 :   1;  // first user-controlled mark
+
+    unsigned       iDiff1 :  30;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+    unsigned       fMark1 :   1;  // second user-controlled mark
+
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fPhase :   1;  // value under 000 pattern
+    unsigned       fUnused:  30;  // unused
+#else
     unsigned       iDiff0 :  29;  // the diff of the first fanin
     unsigned       fCompl0:   1;  // the complemented attribute
     unsigned       fMark0 :   1;  // first user-controlled mark
@@ -85,6 +113,7 @@ struct Gia_Obj_t_
     unsigned       fCompl1:   1;  // the complemented attribute
     unsigned       fMark1 :   1;  // second user-controlled mark
     unsigned       fPhase :   1;  // value under 000 pattern
+#endif
 
     unsigned       Value;         // application-specific value
 };
@@ -104,13 +133,14 @@ struct Gia_Man_t_
     int            nObjsAlloc;    // number of allocated objects
     Gia_Obj_t *    pObjs;         // the array of objects
     unsigned *     pMuxes;        // control signals of MUXes
+    void *         pImage;        // the mapped image holding the objects (if attached)
+    word           nImageSize;    // the size of the mapped image
     int            nXors;         // the number of XORs
     int            nMuxes;        // the number of MUXes 
     int            nBufs;         // the number of buffers
     Vec_Int_t *    vCis;          // the vector of CIs (PIs + LOs)
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
-    Vec_Int_t      vHash;         // hash links
-    Vec_Int_t      vHTable;       // hash table
+    Vec_Wrd_t      vHTable;       // hash table (node ID and key in each slot)
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -133,6 +163,8 @@ struct Gia_Man_t_
     int            nFansAlloc;    // the size of fanout representation
     Vec_Int_t *    vFanoutNums;   // static fanout
     Vec_Int_t *    vFanout;       // static fanout
+    Vec_Int_t      vFanLits0;     // fanin0 literals of the objects (-1 if none)
+    Vec_Int_t      vFanLits1;     // fanin1 literals of the objects (-1 if none)
     Vec_Int_t *    vMapping;      // mapping for each node
     Vec_Wec_t *    vMapping2;     // mapping for each node
     Vec_Wec_t *    vFanouts2;     // mapping fanouts 
@@ -217,6 +249,7 @@ struct Gia_Man_t_
     Vec_Int_t *    vClassOld;
     Vec_Int_t *    vClassNew;
     Vec_Int_t *    vPats;
+    Vec_Int_t *    vProved;       // equivalences proved by SAT sweeping (node, literal of its representative)
     Vec_Bit_t *    vPolars;
     // incremental simulation
     int            fIncrSim;
@@ -288,6 +321,16 @@ struct Emb_Par_t_
 };
 
 
+// concurrent structural hashing
+typedef struct Gia_HashPar_t_ Gia_HashPar_t;
+typedef struct Gia_HashRes_t_ Gia_HashRes_t;
+struct Gia_HashRes_t_
+{
+    int            iNext;         // the next object ID in the block reserved by a thread
+    int            iStop;         // the first object ID past the block
+};
+
+
 // frames parameters
 typedef struct Gia_ParFra_t_ Gia_ParFra_t;
 struct Gia_ParFra_t_
@@ -518,6 +561,12 @@ static inline int          Gia_ObjIsCand( Gia_Obj_t * pObj )                   {
 static inline int          Gia_ObjIsConst0( Gia_Obj_t * pObj )                 { return pObj->iDiff0 == GIA_NONE && pObj->iDiff1 == GIA_NONE;     } 
 static inline int          Gia_ManObjIsConst0( Gia_Man_t * p, Gia_Obj_t * pObj){ return pObj == p->pObjs;                        } 
 
+// structure-of-arrays view of the fanins (see Gia_ManFaninLitsStart)
+static inline int          Gia_ManHasFaninLits( Gia_Man_t * p )                { return Vec_IntSize(&p->vFanLits0) == p->nObjs;   } 
+static inline int          Gia_ObjIsAndLits( int iLit0, int iLit1 )            { return iLit1 >= 0;                              } 
+static inline int          Gia_ObjIsXorLits( int iLit0, int iLit1 )            { return iLit1 >= 0 && Abc_Lit2Var(iLit0) > Abc_Lit2Var(iLit1);  } 
+static inline int          Gia_ObjIsBufLits( int iLit0, int iLit1 )            { return iLit1 >= 0 && Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLit1); } 
+
 static inline int          Gia_Obj2Lit( Gia_Man_t * p, Gia_Obj_t * pObj )      { return Abc_Var2Lit(Gia_ObjId(p, Gia_Regular(pObj)), Gia_IsComplement(pObj)); }
 static inline Gia_Obj_t *  Gia_Lit2Obj( Gia_Man_t * p, int iLit )              { return Gia_NotCond(Gia_ManObj(p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit));  }
 static inline int          Gia_ManCiLit( Gia_Man_t * p, int CiId )             { return Gia_Obj2Lit( p, Gia_ManCi(p, CiId) );                }
@@ -675,17 +724,39 @@ static inline word *       Gia_ObjSimObj( Gia_Man_t * p, Gia_Obj_t * pObj )    {
 
 // AIG construction
 extern void Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
+extern void Gia_ManImageDetach( Gia_Man_t * p, int fCopy );
+
+// extends the fanin view (see Gia_ManFaninLitsStart) if it covers the objects before pObj
+static inline void Gia_ManFaninLitsAppend( Gia_Man_t * p, Gia_Obj_t * pObj )  
+{
+    int iObj = Gia_ObjId( p, pObj );
+    if ( Vec_IntSize(&p->vFanLits0) != iObj )
+        return;
+    Vec_IntPush( &p->vFanLits0, Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) ? Gia_ObjFaninLit0(pObj, iObj) : -1 );
+    Vec_IntPush( &p->vFanLits1, Gia_ObjIsAnd(pObj) ? Gia_ObjFaninLit1(pObj, iObj) : -1 );
+}
 static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )  
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+        int nObjNew;
+        if ( p->nObjs >= GIA_OBJ_MAX )
+        {
+#ifdef ABC_USE_LARGE_GIA
+            printf( "Hard limit on the number of nodes (2^30-1) is reached. Quitting...\n" );
+#else
+            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" );
+            printf( "Recompiling with ABC_USE_LARGE_GIA=1 raises the limit to 2^30-1.\n" );
+#endif
+            exit(1);
+        }
+        nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, GIA_OBJ_MAX );
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
         assert( p->nObjsAlloc > 0 );
+        if ( p->pImage )
+            Gia_ManImageDetach( p, 1 );
         p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
         memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
         if ( p->pMuxes )
@@ -695,7 +766,6 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
         }
         p->nObjsAlloc = nObjNew;
     }
-    if ( Vec_IntSize(&p->vHTable) ) Vec_IntPush( &p->vHash, 0 );
     return Gia_ManObj( p, p->nObjs++ );
 }
 static inline int Gia_ManAppendCi( Gia_Man_t * p )  
@@ -705,6 +775,7 @@ static inline int Gia_ManAppendCi( Gia_Man_t * p )
     pObj->iDiff0 = GIA_NONE;
     pObj->iDiff1 = Vec_IntSize( p->vCis );
     Vec_IntPush( p->vCis, Gia_ObjId(p, pObj) );
+    Gia_ManFaninLitsAppend( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 
@@ -753,6 +824,7 @@ static inline int Gia_ManAppendAnd( Gia_Man_t * p, int iLit0, int iLit1 )
     }
     if ( p->vSuppWords )
         Gia_ManQuantSetSuppAnd( p, pObj );
+    Gia_ManFaninLitsAppend( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendXorReal( Gia_Man_t * p, int iLit0, int iLit1 )  
@@ -778,6 +850,7 @@ static inline int Gia_ManAppendXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit1));
     }
     p->nXors++;
+    Gia_ManFaninLitsAppend( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )  
@@ -790,7 +863,7 @@ static inline int Gia_ManAppendMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int
     assert( Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) );
     assert( Abc_Lit2Var(iLitC) != Abc_Lit2Var(iLit0) );
     assert( Abc_Lit2Var(iLitC) != Abc_Lit2Var(iLit1) );
-    assert( !Vec_IntSize(&p->vHTable) || !Abc_LitIsCompl(iLit1) );
+    assert( !Vec_WrdSize(&p->vHTable) || !Abc_LitIsCompl(iLit1) );
     if ( Abc_Lit2Var(iLit0) < Abc_Lit2Var(iLit1) )
     {
         pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit0));
@@ -808,6 +881,7 @@ static inline int Gia_ManAppendMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int
         p->pMuxes[Gia_ObjId(p, pObj)] = Abc_LitNot(iLitC);
     }
     p->nMuxes++;
+    Gia_ManFaninLitsAppend( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendBuf( Gia_Man_t * p, int iLit )  
@@ -817,6 +891,7 @@ static inline int Gia_ManAppendBuf( Gia_Man_t * p, int iLit )
     pObj->iDiff0  = pObj->iDiff1  = Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit);
     pObj->fCompl0 = pObj->fCompl1 = Abc_LitIsCompl(iLit);
     p->nBufs++;
+    Gia_ManFaninLitsAppend( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendCo( Gia_Man_t * p, int iLit0 )  
@@ -832,6 +907,7 @@ static inline int Gia_ManAppendCo( Gia_Man_t * p, int iLit0 )
     Vec_IntPush( p->vCos, Gia_ObjId(p, pObj) );
     if ( p->pFanData )
         Gia_ObjAddFanout( p, Gia_ObjFanin0(pObj), pObj );
+    Gia_ManFaninLitsAppend( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendOr( Gia_Man_t * p, int iLit0, int iLit1 )
@@ -915,6 +991,8 @@ static inline void Gia_ManPatchCoDriver( Gia_Man_t * p, int iCoIndex, int iLit0
     assert( Gia_ObjId(p, pObjCo) > Abc_Lit2Var(iLit0) );
     pObjCo->iDiff0  = Gia_ObjId(p, pObjCo) - Abc_Lit2Var(iLit0);
     pObjCo->fCompl0 = Abc_LitIsCompl(iLit0);
+    if ( Gia_ManHasFaninLits(p) )
+        Vec_IntWriteEntry( &p->vFanLits0, Gia_ObjId(p, pObjCo), iLit0 );
 }
 
 #define GIA_ZER 1
@@ -1212,6 +1290,8 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
     for ( i = 0; (i < p->nObjs); i++ )                                     if ( !Gia_ObjIsBuf(Gia_ManObj(p, i)) ) {} else
 #define Gia_ManForEachAnd( p, pObj, i )                                 \
     for ( i = 0; (i < p->nObjs) && ((pObj) = Gia_ManObj(p, i)); i++ )      if ( !Gia_ObjIsAnd(pObj) ) {} else
+#define Gia_ManForEachAndLits( p, iLit0, iLit1, i )                     \
+    for ( i = 0; (i < Vec_IntSize(&p->vFanLits1)) && (((iLit0) = Vec_IntEntry(&p->vFanLits0, i)), ((iLit1) = Vec_IntEntry(&p->vFanLits1, i)), 1); i++ ) if ( iLit1 < 0 ) {} else
 #define Gia_ManForEachAndId( p, i )                                     \
     for ( i = 0; (i < p->nObjs); i++ )                                     if ( !Gia_ObjIsAnd(Gia_ManObj(p, i)) ) {} else
 #define Gia_ManForEachMuxId( p, i )                                     \
@@ -1273,9 +1353,12 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nProcs );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nProcs );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_AigerWriteS( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment );
+extern void                Gia_AigerWriteSPar( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment, int nProcs );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
@@ -1501,6 +1584,11 @@ extern int                 Gia_ManHashMux( Gia_Man_t * p, int iCtrl, int iData1,
 extern int                 Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 );
 extern int                 Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 );
 extern Gia_Man_t *         Gia_ManRehash( Gia_Man_t * p, int fAddStrash );
+extern Gia_HashPar_t *     Gia_HashParStart( int nCis, int nObjsMax );
+extern void                Gia_HashParStop( Gia_HashPar_t * p );
+extern int                 Gia_HashParAnd( Gia_HashPar_t * p, Gia_HashRes_t * pRes, int iLit0, int iLit1 );
+extern Gia_Man_t *         Gia_HashParDerive( Gia_HashPar_t * p, Gia_Man_t * pOrig, Vec_Int_t * vCopies );
+extern Gia_Man_t *         Gia_ManRehashPar( Gia_Man_t * p, int nThreads );
 extern void                Gia_ManHashProfile( Gia_Man_t * p );
 extern int                 Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
@@ -1527,6 +1615,10 @@ extern Gia_Man_t *         Gia_ManPerformMapping( Gia_Man_t * p, void * pIfPars
 extern Gia_Man_t *         Gia_ManPerformSopBalance( Gia_Man_t * p, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformDsdBalance( Gia_Man_t * p, int nLutSize, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManDupHashMapping( Gia_Man_t * p );
+/*=== giaImage.c ===========================================================*/
+extern int                 Gia_ManImageWrite( Gia_Man_t * p, char * pFileName );
+extern int                 Gia_ManImageIsFile( char * pFileName );
+extern Gia_Man_t *         Gia_ManImageRead( char * pFileName, int fGiaSimple, int fSkipStrash );
 /*=== giaJf.c ===========================================================*/
 extern void                Jf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Jf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
@@ -1638,6 +1730,7 @@ extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, i
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern Vec_Wrd_t *         Gia_ManSimPatSimLevel( Gia_Man_t * pGia, int nProcs );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
@@ -1764,6 +1857,8 @@ extern int                 Gia_ManSetLevels( Gia_Man_t * p, Vec_Int_t * vCiLevel
 extern Vec_Int_t *         Gia_ManReverseLevel( Gia_Man_t * p );
 extern Vec_Int_t *         Gia_ManRequiredLevel( Gia_Man_t * p );
 extern void                Gia_ManCreateValueRefs( Gia_Man_t * p );
+extern void                Gia_ManFaninLitsStart( Gia_Man_t * p );
+extern void                Gia_ManFaninLitsStop( Gia_Man_t * p );
 extern void                Gia_ManCreateRefs( Gia_Man_t * p );
 extern void                Gia_ManCreateLitRefs( Gia_Man_t * p );
 extern int *               Gia_ManCreateMuxRefs( Gia_Man_t * p );
@@ -22,6 +22,15 @@
 #include "gia.h"
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
+#include "misc/zlib/zlib.h"
+#include "misc/bzlib/bzlib.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -162,6 +171,156 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Encodes and decodes the AND section in independent blocks.]
+
+  Description [The optional extension "x" records the byte offsets of
+  the blocks of GIA_AIGER_BLOCK consecutive AND nodes in the AND section.
+  Because each delta depends only on the node and its fanins, the blocks
+  can be encoded and decoded concurrently. The extension is written last,
+  so that older readers, which stop at an unknown extension, still read
+  all other extensions. It is located without decoding the AND section
+  using the footer at the end of the file, which contains the letters
+  "AIGX" followed by the file position of the extension.
+  The format of the extension is: the size of the data in bytes, the
+  number of AND nodes, the number of nodes in a block, the number of
+  blocks, followed by the offset of each block and the size of the AND
+  section, all counted in bytes from the beginning of the AND section.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_AIGER_BLOCK  (1 << 16)  // the number of AND nodes in one block
+
+typedef struct Gia_AigerBlock_t_ Gia_AigerBlock_t;
+struct Gia_AigerBlock_t_
+{
+    Gia_Man_t *     p;             // the AIG being written
+    unsigned char * pBuffer;       // the encoded block
+    unsigned *      pLits;         // the decoded fanin literals of all AND nodes
+    int             nCis;          // the number of CIs
+    int             iBeg;          // the first AND node of the block
+    int             iEnd;          // the AND node following the block
+    int             nBytes;        // the size of the encoded block
+    int             fError;        // the decoded size does not match
+};
+
+int Gia_AigerEncodeBlock( void * pArg )
+{
+    Gia_AigerBlock_t * pBlock = (Gia_AigerBlock_t *)pArg;
+    Gia_Obj_t * pObj;
+    unsigned uLit0, uLit1, uLit;
+    int k, iObj, Pos = 0;
+    pBlock->pBuffer = ABC_ALLOC( unsigned char, 10 * (pBlock->iEnd - pBlock->iBeg) );
+    for ( k = pBlock->iBeg; k < pBlock->iEnd; k++ )
+    {
+        iObj  = 1 + pBlock->nCis + k;
+        pObj  = Gia_ManObj( pBlock->p, iObj );
+        assert( Gia_ObjIsAnd(pObj) );
+        uLit  = Abc_Var2Lit( iObj, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, iObj );
+        uLit1 = Gia_ObjFaninLit1( pObj, iObj );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBlock->pBuffer, Pos, uLit  - uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBlock->pBuffer, Pos, uLit1 - uLit0 );
+    }
+    pBlock->nBytes  = Pos;
+    pBlock->pBuffer = ABC_REALLOC( unsigned char, pBlock->pBuffer, Pos );
+    return 1;
+}
+int Gia_AigerDecodeBlock( void * pArg )
+{
+    Gia_AigerBlock_t * pBlock = (Gia_AigerBlock_t *)pArg;
+    unsigned char * pCur = pBlock->pBuffer;
+    unsigned uLit0, uLit1, uLit;
+    int k;
+    for ( k = pBlock->iBeg; k < pBlock->iEnd; k++ )
+    {
+        uLit  = ((k + 1 + pBlock->nCis) << 1);
+        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        pBlock->pLits[2*k+0] = uLit0;
+        pBlock->pLits[2*k+1] = uLit1;
+    }
+    pBlock->fError = (pCur != pBlock->pBuffer + pBlock->nBytes);
+    return 1;
+}
+void Gia_AigerProcessBlocks( Gia_AigerBlock_t * pBlocks, int nBlocks, int (*pFunc)(void *), int nProcs )
+{
+    Util_Sched_t * pSched;
+    int b;
+    if ( nProcs <= 1 || nBlocks == 1 )
+    {
+        for ( b = 0; b < nBlocks; b++ )
+            pFunc( (void *)(pBlocks + b) );
+        return;
+    }
+    pSched = Util_SchedStart( Abc_MinInt(nProcs, nBlocks) );
+    for ( b = 0; b < nBlocks; b++ )
+        Util_SchedSubmit( pSched, pFunc, (void *)(pBlocks + b) );
+    Util_SchedWaitAll( pSched );
+    Util_SchedStop( pSched );
+}
+// returns the block offsets stored in the extension "x" if it is present and consistent
+Vec_Int_t * Gia_AigerReadIndex( char * pContents, int nFileSize, unsigned char * pAnds, int nAnds )
+{
+    Vec_Int_t * vOffsets;
+    unsigned char * pCur, * pFooter = (unsigned char *)pContents + nFileSize - 8;
+    int i, Pos, nSize, nBlocks;
+    if ( nFileSize < 8 || strncmp( (char *)pFooter, "AIGX", 4 ) )
+        return NULL;
+    Pos = Gia_AigerReadInt( pFooter + 4 );
+    if ( Pos <= pAnds - (unsigned char *)pContents || Pos + 17 > nFileSize - 8 || pContents[Pos] != 'x' )
+        return NULL;
+    pCur    = (unsigned char *)pContents + Pos + 1;
+    nSize   = Gia_AigerReadInt( pCur );         pCur += 4;
+    if ( Gia_AigerReadInt(pCur) != nAnds || Gia_AigerReadInt(pCur + 4) != GIA_AIGER_BLOCK )
+        return NULL;
+    nBlocks = Gia_AigerReadInt( pCur + 8 );     pCur += 12;
+    if ( nBlocks != (nAnds + GIA_AIGER_BLOCK - 1) / GIA_AIGER_BLOCK || nSize != 4 * (nBlocks + 4) || Pos + 5 + nSize > nFileSize - 8 )
+        return NULL;
+    vOffsets = Vec_IntAlloc( nBlocks + 1 );
+    for ( i = 0; i <= nBlocks; i++, pCur += 4 )
+        Vec_IntPush( vOffsets, Gia_AigerReadInt(pCur) );
+    for ( i = 0; i < nBlocks; i++ )
+        if ( Vec_IntEntry(vOffsets, i) > Vec_IntEntry(vOffsets, i+1) )
+            break;
+    if ( i < nBlocks || Vec_IntEntry(vOffsets, 0) != 0 || pAnds + Vec_IntEntryLast(vOffsets) > (unsigned char *)pContents + Pos )
+    {
+        Vec_IntFree( vOffsets );
+        return NULL;
+    }
+    return vOffsets;
+}
+// decodes the AND section using the block offsets; returns the fanin literals or NULL
+unsigned * Gia_AigerReadAndsIndexed( unsigned char * pAnds, Vec_Int_t * vOffsets, int nCis, int nAnds, int nProcs )
+{
+    int b, nBlocks = Vec_IntSize(vOffsets) - 1, fError = 0;
+    Gia_AigerBlock_t * pBlocks = ABC_CALLOC( Gia_AigerBlock_t, nBlocks );
+    unsigned * pLits = ABC_ALLOC( unsigned, 2 * (size_t)nAnds );
+    for ( b = 0; b < nBlocks; b++ )
+    {
+        pBlocks[b].pBuffer = pAnds + Vec_IntEntry(vOffsets, b);
+        pBlocks[b].nBytes  = Vec_IntEntry(vOffsets, b+1) - Vec_IntEntry(vOffsets, b);
+        pBlocks[b].pLits   = pLits;
+        pBlocks[b].nCis    = nCis;
+        pBlocks[b].iBeg    = b * GIA_AIGER_BLOCK;
+        pBlocks[b].iEnd    = Abc_MinInt( (b + 1) * GIA_AIGER_BLOCK, nAnds );
+    }
+    Gia_AigerProcessBlocks( pBlocks, nBlocks, Gia_AigerDecodeBlock, nProcs );
+    for ( b = 0; b < nBlocks; b++ )
+        fError |= pBlocks[b].fError;
+    ABC_FREE( pBlocks );
+    if ( fError )
+    {
+        printf( "The block index of the AIGER file is inconsistent with the AND section and is ignored.\n" );
+        ABC_FREE( pLits );
+    }
+    return pLits;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -174,6 +333,10 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nProcs )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
@@ -183,7 +346,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
     unsigned char * pDrivers, * pSymbols, * pCur;
-    unsigned uLit0, uLit1, uLit;
+    unsigned uLit0, uLit1, uLit, * pLits = NULL;
 
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
@@ -283,14 +446,41 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
+    // decode the AND gates in parallel if the file has the block index
+    if ( nProcs > 1 && nAnds > 0 )
+    {
+        Vec_Int_t * vOffsets = Gia_AigerReadIndex( pContents, nFileSize, pCur, nAnds );
+        if ( vOffsets )
+        {
+            pLits = Gia_AigerReadAndsIndexed( pCur, vOffsets, nInputs + nLatches, nAnds, nProcs );
+            if ( pLits )
+                pCur += Vec_IntEntryLast( vOffsets );
+            Vec_IntFree( vOffsets );
+        }
+    }
+
     // create the AND gates
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
     for ( i = 0; i < nAnds; i++ )
     {
         uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pLits )
+        {
+            uLit0 = pLits[2*i+0];
+            uLit1 = pLits[2*i+1];
+        }
+        else if ( !((pCur[0] | pCur[1]) & 0x80) ) // both deltas fit into one byte
+        {
+            uLit1 = uLit  - pCur[0];
+            uLit0 = uLit1 - pCur[1];
+            pCur += 2;
+        }
+        else
+        {
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -307,6 +497,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
+    ABC_FREE( pLits );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -444,7 +635,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 }
                 else if ( *pType == 'n' )
                 {
-                    if ( Vec_IntSize(&pNew->vHTable) != 0 )
+                    if ( Vec_WrdSize(&pNew->vHTable) != 0 )
                     {
                         printf( "Structural hashing should be disabled to read internal nodes names.\n" );
                         fError = 1;
@@ -870,6 +1061,13 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                     printf( "Cannot read extension \"w\" because AIG is rehashed. Use \"&r -s <file.aig>\".\n" );
                 Vec_IntFree( vPairs );
             }
+            // skip the block index, which is used before reading the AND gates
+            else if ( *pCur == 'x' )
+            {
+                pCur++;
+                pCur += Gia_AigerReadInt(pCur) + 4;
+                if ( fVerbose ) printf( "Finished reading extension \"x\".\n" );
+            }
             else break;
         }
     }
@@ -1003,11 +1201,183 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Loads the compressed AIGER file into memory.]
+
+  Description [Returns NULL if the file is not compressed with gzip or bzip2.
+  Otherwise, decompresses the file in chunks directly into the resulting
+  buffer, which is grown as needed, without keeping the compressed data
+  or the intermediate chunks in memory. If decompression fails, or the
+  uncompressed file does not fit into the int-indexed buffer used by the
+  reader, or memory cannot be allocated, prints an error, sets the file 
+  size to -1, and returns NULL.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_AIGER_MAX_SIZE  ((size_t)0x7FFFFFFF)  // the largest file size supported by the reader
+
+// makes room for at least one more byte; frees the buffer and returns NULL on failure
+static char * Gia_AigerLoadGrow( char * pContents, size_t * pnAlloc, size_t nSize, char * pFileName )
+{
+    char * pTemp;
+    if ( pContents && nSize < *pnAlloc )
+        return pContents;
+    if ( *pnAlloc == GIA_AIGER_MAX_SIZE )
+    {
+        printf( "Gia_AigerLoadCompressed(): The uncompressed file \"%s\" is larger than %d bytes.\n", pFileName, (int)GIA_AIGER_MAX_SIZE );
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    if ( pContents == NULL )
+        *pnAlloc = (1 << 22);
+    else
+        *pnAlloc = *pnAlloc < GIA_AIGER_MAX_SIZE / 2 ? 2 * *pnAlloc : GIA_AIGER_MAX_SIZE;
+    pTemp = ABC_REALLOC( char, pContents, *pnAlloc );
+    if ( pTemp == NULL )
+    {
+        printf( "Gia_AigerLoadCompressed(): Cannot allocate %.0f MB to decompress file \"%s\".\n", 1.0 * *pnAlloc / (1 << 20), pFileName );
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    return pTemp;
+}
+static char * Gia_AigerLoadCompressed( char * pFileName, int * pnFileSize )
+{
+    size_t nChunk = (1 << 20), nAlloc = 0, nSize = 0;
+    unsigned char Magic[3] = {0};
+    char * pContents = NULL;
+    int nRead;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    nRead = fread( Magic, 1, 3, pFile );
+    if ( nRead == 3 && Magic[0] == 'B' && Magic[1] == 'Z' && Magic[2] == 'h' ) // bzip2
+    {
+        int bzError, bzErrorRead;
+        BZFILE * b;
+        rewind( pFile );
+        b = BZ2_bzReadOpen( &bzError, pFile, 0, 0, NULL, 0 );
+        if ( bzError != BZ_OK )
+        {
+            printf( "Gia_AigerLoadCompressed(): BZ2_bzReadOpen() failed with error %d.\n", bzError );
+            fclose( pFile );
+            *pnFileSize = -1;
+            return NULL;
+        }
+        do {
+            if ( (pContents = Gia_AigerLoadGrow( pContents, &nAlloc, nSize, pFileName )) == NULL )
+                break;
+            nRead = BZ2_bzRead( &bzError, b, pContents + nSize, (int)Abc_MinWord(nChunk, nAlloc - nSize) );
+            if ( nRead > 0 )
+                nSize += nRead;
+        } while ( bzError == BZ_OK );
+        bzErrorRead = bzError;
+        BZ2_bzReadClose( &bzError, b );
+        fclose( pFile );
+        if ( pContents == NULL )
+        {
+            *pnFileSize = -1;
+            return NULL;
+        }
+        if ( bzErrorRead != BZ_OK && bzErrorRead != BZ_STREAM_END )
+        {
+            printf( "Gia_AigerLoadCompressed(): Unable to decompress file \"%s\".\n", pFileName );
+            ABC_FREE( pContents );
+            *pnFileSize = -1;
+            return NULL;
+        }
+        *pnFileSize = (int)nSize;
+        return pContents;
+    }
+    fclose( pFile );
+    if ( nRead >= 2 && Magic[0] == 0x1f && Magic[1] == 0x8b ) // gzip
+    {
+        gzFile pGzFile = gzopen( pFileName, "rb" );
+        if ( pGzFile == NULL )
+            return NULL;
+        while ( 1 )
+        {
+            if ( (pContents = Gia_AigerLoadGrow( pContents, &nAlloc, nSize, pFileName )) == NULL )
+                break;
+            nRead = gzread( pGzFile, pContents + nSize, (unsigned)Abc_MinWord(nChunk, nAlloc - nSize) );
+            if ( nRead <= 0 )
+                break;
+            nSize += nRead;
+        }
+        gzclose( pGzFile );
+        if ( pContents == NULL )
+        {
+            *pnFileSize = -1;
+            return NULL;
+        }
+        if ( nRead < 0 )
+        {
+            printf( "Gia_AigerLoadCompressed(): Unable to decompress file \"%s\".\n", pFileName );
+            ABC_FREE( pContents );
+            *pnFileSize = -1;
+            return NULL;
+        }
+        *pnFileSize = (int)nSize;
+        return pContents;
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the uncompressed AIGER file into memory.]
+
+  Description [The mapping is private, so the reader can modify the buffer
+  in place (it terminates the symbol names) without changing the file and
+  without copying the pages it does not modify. Returns NULL if the file
+  cannot be mapped; the caller then reads it into a heap buffer.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_AigerMapFile( char * pFileName, int nFileSize )
+{
+#ifndef _WIN32
+    void * pMap;
+    int fd;
+    // reading past the end of the last page would raise SIGBUS
+    if ( nFileSize <= 0 || nFileSize % sysconf(_SC_PAGESIZE) == 0 )
+        return NULL;
+    fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    pMap = mmap( NULL, (size_t)nFileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pMap == MAP_FAILED )
+        return NULL;
+    madvise( pMap, (size_t)nFileSize, MADV_SEQUENTIAL );
+    return (char *)pMap;
+#else
+    return NULL;
+#endif
+}
+static void Gia_AigerUnmapFile( char * pContents, int nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, (size_t)nFileSize );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [Uncompressed files are mapped into memory and decoded in
+  place. Files compressed with gzip or bzip2 are decompressed first.
+  If the file has the block index, the AND section is decoded using
+  nProcs threads. Memory images written by Gia_ManImageWrite() are
+  attached without decoding.]
   
   SideEffects []
 
@@ -1015,23 +1385,45 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nProcs )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
+    int nFileSize = 0, fMapped = 0;
     int RetValue;
 
-    // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    if ( Gia_ManImageIsFile( pFileName ) )
+        return Gia_ManImageRead( pFileName, fGiaSimple, fSkipStrash );
+    pContents = Gia_AigerLoadCompressed( pFileName, &nFileSize );
+    if ( pContents == NULL && nFileSize < 0 )
+        return NULL;
+    if ( pContents == NULL )
+    {
+        nFileSize = Gia_FileSize( pFileName );
+        pContents = Gia_AigerMapFile( pFileName, nFileSize );
+        fMapped = (pContents != NULL);
+    }
+    if ( pContents == NULL )
+    {
+        // read the file into the buffer
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
+    }
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nProcs );
+    if ( fMapped )
+        Gia_AigerUnmapFile( pContents, nFileSize );
+    else
+        ABC_FREE( pContents );
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1218,13 +1610,18 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 
 ***********************************************************************/
 void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+{
+    Gia_AigerWriteSPar( pInit, pFileName, fWriteSymbols, fCompact, fWriteNewLine, fSkipComment, 0 );
+}
+void Gia_AigerWriteSPar( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment, int nProcs )
 {
     int fVerbose = XAIG_VERBOSE;
     FILE * pFile;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
+    Vec_Int_t * vOffsets = NULL;
+    int i, nBufferSize, Pos, PosIndex = -1;
     unsigned char * pBuffer;
     unsigned uLit0, uLit1, uLit;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
@@ -1289,32 +1686,58 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
+    // write the nodes in independent blocks and remember their offsets
+    if ( nProcs > 0 && Gia_ManAndNum(p) > 0 )
     {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
+        int b, nBlocks = (Gia_ManAndNum(p) + GIA_AIGER_BLOCK - 1) / GIA_AIGER_BLOCK;
+        Gia_AigerBlock_t * pBlocks = ABC_CALLOC( Gia_AigerBlock_t, nBlocks );
+        for ( b = 0; b < nBlocks; b++ )
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            pBlocks[b].p    = p;
+            pBlocks[b].nCis = Gia_ManCiNum(p);
+            pBlocks[b].iBeg = b * GIA_AIGER_BLOCK;
+            pBlocks[b].iEnd = Abc_MinInt( (b + 1) * GIA_AIGER_BLOCK, Gia_ManAndNum(p) );
+        }
+        Gia_AigerProcessBlocks( pBlocks, nBlocks, Gia_AigerEncodeBlock, nProcs );
+        vOffsets = Vec_IntAlloc( nBlocks + 1 );
+        Vec_IntPush( vOffsets, 0 );
+        for ( b = 0; b < nBlocks; b++ )
+        {
+            fwrite( pBlocks[b].pBuffer, 1, pBlocks[b].nBytes, pFile );
+            Vec_IntPush( vOffsets, Vec_IntEntryLast(vOffsets) + pBlocks[b].nBytes );
+            ABC_FREE( pBlocks[b].pBuffer );
         }
+        ABC_FREE( pBlocks );
     }
-    assert( Pos < nBufferSize );
+    else
+    {
+        // write the nodes into the buffer
+        Pos = 0;
+        nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+        pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+        Gia_ManForEachAnd( p, pObj, i )
+        {
+            uLit  = Abc_Var2Lit( i, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, i );
+            uLit1 = Gia_ObjFaninLit1( pObj, i );
+            assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+            if ( Pos > nBufferSize - 10 )
+            {
+                printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
+                fclose( pFile );
+                if ( p != pInit )
+                    Gia_ManStop( p );
+                return;
+            }
+        }
+        assert( Pos < nBufferSize );
 
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+        // write the buffer
+        fwrite( pBuffer, 1, Pos, pFile );
+        ABC_FREE( pBuffer );
+    }
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1566,6 +1989,19 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         fwrite( p->pName, 1, strlen(p->pName), pFile );
         fprintf( pFile, "%c", '\0' );
     }
+    // write the block index (should be the last extension)
+    if ( vOffsets )
+    {
+        PosIndex = (int)ftell( pFile );
+        fprintf( pFile, "x" );
+        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vOffsets)+3) );
+        Gia_FileWriteBufferSize( pFile, Gia_ManAndNum(p) );
+        Gia_FileWriteBufferSize( pFile, GIA_AIGER_BLOCK );
+        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vOffsets)-1 );
+        for ( i = 0; i < Vec_IntSize(vOffsets); i++ )
+            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vOffsets, i) );
+        Vec_IntFree( vOffsets );
+    }
     // write comments
     if ( fWriteNewLine )
         fprintf( pFile, "c\n" );
@@ -1573,6 +2009,12 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
         fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
     }
+    // write the footer pointing to the block index
+    if ( PosIndex >= 0 )
+    {
+        fprintf( pFile, "AIGX" );
+        Gia_FileWriteBufferSize( pFile, PosIndex );
+    }
     fclose( pFile );
     if ( p != pInit )
     {
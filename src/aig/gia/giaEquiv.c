@@ -2750,7 +2750,7 @@ void Gia_ManTransferTest( Gia_Man_t * p )
     for ( i = 0; i < Gia_ManObjNum(p); i++ )
         pReprs[i].fProved = 0;
         //printf( "%5d :    %5d %5d    %5d %5d\n", i, *(int*)&p->pReprs[i], *(int*)&pReprs[i], (int)p->pNexts[i], (int)pNexts[i] );
-    if ( memcmp(p->pReprs, pReprs, sizeof(int)*Gia_ManObjNum(p)) )
+    if ( memcmp(p->pReprs, pReprs, sizeof(Gia_Rpr_t)*Gia_ManObjNum(p)) )
         printf( "Verification of reprs failed.\n" );
     else
         printf( "Verification of reprs succeeded.\n" );
@@ -20,6 +20,10 @@
 
 #include "gia.h"
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -35,36 +39,66 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Returns the place where this node is stored (or should be stored).]
 
-  Description []
+  Description [The hash table uses open addressing with linear probing.
+  The number of slots is a power of two. Each slot is one word of
+  p->vHTable holding the node ID in the lower half (0 if the slot is
+  empty) and the hash key of the node in the upper half. Eight slots
+  share a cache line, and the keys are compared before the node is
+  accessed, so an unsuccessful probe rarely touches the node array.
+  If the node is not found, the key is written into the empty slot,
+  and the caller only needs to add the ID using Gia_ManHashSetId().]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize ) 
+#define GIA_HASH_LOAD_NUM 3   // the max load factor of the table is 3/4
+#define GIA_HASH_LOAD_DEN 4
+#define GIA_HASH_SLOT_MAX (1 << 30)   // the largest table that fits into a vector
+
+// returns the number of slots needed to keep the given number of nodes
+static inline int Gia_ManHashSlotsFor( int nNodes )
 {
-    unsigned Key = iLitC * 2011;
-    Key += Abc_Lit2Var(iLit0) * 7937;
-    Key += Abc_Lit2Var(iLit1) * 2971;
-    Key += Abc_LitIsCompl(iLit0) * 911;
-    Key += Abc_LitIsCompl(iLit1) * 353;
-    return (int)(Key % TableSize);
+    word nSlots = GIA_HASH_LOAD_DEN * (word)nNodes / GIA_HASH_LOAD_NUM + 1;
+    return nSlots >= GIA_HASH_SLOT_MAX ? GIA_HASH_SLOT_MAX : 1 << Abc_Base2Log( (unsigned)nSlots );
 }
-static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
+
+static inline unsigned Gia_ManHashKey( int iLit0, int iLit1, int iLitC ) 
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
-    assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
+    unsigned Key = (unsigned)iLit0 * 0x9E3779B1 + (unsigned)iLit1 * 0x85EBCA77 + (unsigned)(iLitC + 1) * 0xC2B2AE3D;
+    Key ^= Key >> 15;
+    Key *= 0x2C1B3C6D;
+    Key ^= Key >> 12;
+    return Key;
+}
+static inline int  Gia_ManHashSlotNum( Gia_Man_t * p )              { return Vec_WrdSize(&p->vHTable);   }
+static inline int  Gia_ManHashId( word * pPlace )                   { return (int)(unsigned)*pPlace;     }
+static inline void Gia_ManHashSetId( word * pPlace, int Id )        { *pPlace |= (word)(unsigned)Id;     }
+static inline unsigned Gia_ManHashSlotKey( word Slot )              { return (unsigned)(Slot >> 32);     }
+
+static inline word * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
+{
+    unsigned Key  = Gia_ManHashKey( iLit0, iLit1, iLitC );
+    unsigned Mask = (unsigned)Gia_ManHashSlotNum(p) - 1;
+    unsigned iSlot;
+    word * pTable = Vec_WrdArray( &p->vHTable );
+    int iThis;
+    assert( Vec_WrdSize(&p->vHTable) > 0 );
     assert( p->pMuxes || iLit0 < iLit1 );
     assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
     assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
-    for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
+    for ( iSlot = Key & Mask; (iThis = Gia_ManHashId(pTable + iSlot)); iSlot = (iSlot + 1) & Mask )
     {
-        Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
+        Gia_Obj_t * pThis;
+        if ( Gia_ManHashSlotKey(pTable[iSlot]) != Key )
+            continue;
+        pThis = Gia_ManObj( p, iThis );
         if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
-            break;
+            return pTable + iSlot;
     }
-    return pPlace;
+    pTable[iSlot] = (word)Key << 32;
+    return pTable + iSlot;
 }
 
 /**Function*************************************************************
@@ -82,7 +116,7 @@ int Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 )
 {
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
-    return Abc_Var2Lit( *Gia_ManHashFind( p, iLit0, iLit1, -1 ), 0 );
+    return Abc_Var2Lit( Gia_ManHashId(Gia_ManHashFind( p, iLit0, iLit1, -1 )), 0 );
 }
 int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 {
@@ -104,11 +138,11 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 ***********************************************************************/
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
-    assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
-    Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
-    Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
-//printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
+    int nNodes = Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc;
+    int nSlots = Gia_ManHashSlotsFor( nNodes );
+    assert( Vec_WrdSize(&p->vHTable) == 0 );
+    Vec_WrdFill( &p->vHTable, nSlots, 0 );
+//printf( "Alloced table with %d entries.\n", Gia_ManHashSlotNum(p) );
 }
 
 /**Function*************************************************************
@@ -125,13 +159,14 @@ void Gia_ManHashAlloc( Gia_Man_t * p )
 void Gia_ManHashStart( Gia_Man_t * p )  
 {
     Gia_Obj_t * pObj;
-    int * pPlace, i;
+    word * pPlace;
+    int i;
     Gia_ManHashAlloc( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
         pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
-        assert( *pPlace == 0 );
-        *pPlace = i;
+        assert( Gia_ManHashId(pPlace) == 0 );
+        Gia_ManHashSetId( pPlace, i );
     }
 }
 
@@ -148,8 +183,7 @@ void Gia_ManHashStart( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashStop( Gia_Man_t * p )  
 {
-    Vec_IntErase( &p->vHTable );
-    Vec_IntErase( &p->vHash );
+    Vec_WrdErase( &p->vHTable );
 }
 
 /**Function*************************************************************
@@ -165,32 +199,37 @@ void Gia_ManHashStop( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashResize( Gia_Man_t * p )
 {
-    int i, iThis, iNext, Counter, Counter2, * pPlace;
-    Vec_Int_t vOld = p->vHTable;
-    assert( Vec_IntSize(&vOld) > 0 );
+    Vec_Wrd_t vOld = p->vHTable;
+    int nNodes = Abc_MaxInt( Gia_ManAndNum(p), Vec_WrdSize(&vOld) );
+    unsigned Mask, iSlot;
+    word * pTable, Slot;
+    int i, Counter = 0;
+    assert( Vec_WrdSize(&vOld) > 0 );
     // replace the table
-    Vec_IntZero( &p->vHTable );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
-    // rehash the entries from the old table
-    Counter = 0;
-    Vec_IntForEachEntry( &vOld, iThis, i )
-        for ( iNext = Vec_IntEntry(&p->vHash, iThis);  
-              iThis;  iThis = iNext,   
-              iNext = Vec_IntEntry(&p->vHash, iThis)  )
-        {
-            Gia_Obj_t * pThis0 = Gia_ManObj( p, iThis );
-            Vec_IntWriteEntry( &p->vHash, iThis, 0 );
-            pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pThis0, iThis), Gia_ObjFaninLit1(pThis0, iThis), Gia_ObjFaninLit2p(p, pThis0) );
-            assert( *pPlace == 0 ); // should not be there
-            *pPlace = iThis;
-            assert( *pPlace != 0 );
-            Counter++;
-        }
-    Counter2 = Gia_ManAndNum(p) - Gia_ManBufNum(p);
-    assert( Counter == Counter2 );
+    memset( &p->vHTable, 0, sizeof(Vec_Wrd_t) );
+    Vec_WrdFill( &p->vHTable, Gia_ManHashSlotsFor( nNodes ), 0 );
+    pTable = Vec_WrdArray( &p->vHTable );
+    Mask = (unsigned)Gia_ManHashSlotNum(p) - 1;
+    // move the entries using the stored keys, without accessing the nodes
+    Vec_WrdForEachEntry( &vOld, Slot, i )
+    {
+        if ( Gia_ManHashId(&Slot) == 0 )
+            continue;
+        for ( iSlot = Gia_ManHashSlotKey(Slot) & Mask; pTable[iSlot]; iSlot = (iSlot + 1) & Mask );
+        pTable[iSlot] = Slot;
+        Counter++;
+    }
+    assert( Counter <= Gia_ManAndNum(p) - Gia_ManBufNum(p) );
 //    if ( p->fVerbose )
-//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&vOld), Vec_IntSize(&p->vHTable) );
-    Vec_IntErase( &vOld );
+//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_WrdSize(&vOld), Gia_ManHashSlotNum(p) );
+    Vec_WrdErase( &vOld );
+}
+// makes sure there is room for one more node in the table
+// (the largest table is never full because it has more slots than GIA_OBJ_MAX)
+static inline void Gia_ManHashReserve( Gia_Man_t * p )
+{
+    if ( Gia_ManHashSlotNum(p) < GIA_HASH_SLOT_MAX && GIA_HASH_LOAD_DEN * (word)Gia_ManAndNum(p) >= GIA_HASH_LOAD_NUM * (word)Gia_ManHashSlotNum(p) )
+        Gia_ManHashResize( p );
 }
 
 /**Function********************************************************************
@@ -206,22 +245,22 @@ void Gia_ManHashResize( Gia_Man_t * p )
 ******************************************************************************/
 void Gia_ManHashProfile( Gia_Man_t * p )
 {
-    int iEntry;
-    int i, Counter, Limit;
-    printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
-    printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
-    Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
-    for ( i = 0; i < Limit; i++ )
+    unsigned Mask = (unsigned)Gia_ManHashSlotNum(p) - 1;
+    int i, nEntries = 0, nProbes = 0, nProbesMax = 0, Dist;
+    word Slot;
+    Vec_WrdForEachEntry( &p->vHTable, Slot, i )
     {
-        Counter = 0;
-        for ( iEntry = Vec_IntEntry(&p->vHTable, i); 
-              iEntry; 
-              iEntry = iEntry? Vec_IntEntry(&p->vHash, iEntry) : 0 )
-            Counter++;
-        if ( Counter ) 
-            printf( "%d ", Counter );
+        if ( Gia_ManHashId(&Slot) == 0 )
+            continue;
+        // the distance from the slot where the key is supposed to be
+        Dist = (int)(((unsigned)i - Gia_ManHashSlotKey(Slot)) & Mask);
+        nProbes += Dist + 1;
+        nProbesMax = Abc_MaxInt( nProbesMax, Dist + 1 );
+        nEntries++;
     }
-    printf( "\n" );
+    printf( "Table size = %d. Entries = %d. ", Gia_ManHashSlotNum(p), nEntries );
+    printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
+    printf( "Probes per entry: average = %.2f. max = %d.\n", nEntries ? 1.0*nProbes/nEntries : 0.0, nProbesMax );
 }
 
 /**Function*************************************************************
@@ -478,8 +517,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashReserve( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     if ( Abc_LitIsCompl(iLit0) )
@@ -487,23 +525,15 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
     if ( Abc_LitIsCompl(iLit1) )
         iLit1 = Abc_LitNot(iLit1), fCompl ^= 1;
     {
-        int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-        if ( *pPlace )
+        word * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
+        if ( Gia_ManHashId(pPlace) )
         {
             p->nHashHit++;
-            return Abc_Var2Lit( *pPlace, fCompl );
+            return Abc_Var2Lit( Gia_ManHashId(pPlace), fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendXorReal( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
-        return Abc_Var2Lit( *pPlace, fCompl );
+        Gia_ManHashSetId( pPlace, Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) ) );
+        return Abc_Var2Lit( Gia_ManHashId(pPlace), fCompl );
     }
 }
 
@@ -541,24 +571,17 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Abc_LitNot(iLitC);
     if ( Abc_LitIsCompl(iLit1) )
         iLit0 = Abc_LitNot(iLit0), iLit1 = Abc_LitNot(iLit1), fCompl = 1;
+    Gia_ManHashReserve( p );
     {
-        int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-        if ( *pPlace )
+        word * pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
+        if ( Gia_ManHashId(pPlace) )
         {
             p->nHashHit++;
-            return Abc_Var2Lit( *pPlace, fCompl );
+            return Abc_Var2Lit( Gia_ManHashId(pPlace), fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
-        else
-        {
-            int iNode = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
-        return Abc_Var2Lit( *pPlace, fCompl );
+        Gia_ManHashSetId( pPlace, Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) ) );
+        return Abc_Var2Lit( Gia_ManHashId(pPlace), fCompl );
     }
 }
 
@@ -585,11 +608,10 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( p->fGiaSimple )
     {
-        assert( Vec_IntSize(&p->vHTable) == 0 );
+        assert( Vec_WrdSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashReserve( p );
     if ( p->fAddStrash )
     {
         Gia_Obj_t * pObj = Gia_ManAddStrash( p, Gia_ObjFromLit(p, iLit0), Gia_ObjFromLit(p, iLit1) );
@@ -599,23 +621,15 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     {
-        int * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-        if ( *pPlace )
+        word * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
+        if ( Gia_ManHashId(pPlace) )
         {
             p->nHashHit++;
-            return Abc_Var2Lit( *pPlace, 0 );
+            return Abc_Var2Lit( Gia_ManHashId(pPlace), 0 );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendAnd( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
-        return Abc_Var2Lit( *pPlace, 0 );
+        Gia_ManHashSetId( pPlace, Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) ) );
+        return Abc_Var2Lit( Gia_ManHashId(pPlace), 0 );
     }
 }
 int Gia_ManHashOr( Gia_Man_t * p, int iLit0, int iLit1 )  
@@ -647,9 +661,9 @@ int Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 )
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     {
-        int * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-        if ( *pPlace ) 
-            return Abc_Var2Lit( *pPlace, 0 );
+        word * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
+        if ( Gia_ManHashId(pPlace) ) 
+            return Abc_Var2Lit( Gia_ManHashId(pPlace), 0 );
         return -1;
     }
 }
@@ -769,6 +783,351 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Concurrent structural hashing.]
+
+  Description [Several threads can add AND nodes to the same manager at
+  the same time. The table is the open-addressing table used above: a new 
+  node is written into an object ID reserved by the thread, and is then
+  published by a compare-and-swap of the empty slot. If another thread 
+  wins the slot, the ID stays reserved and is reused for the next node.
+  The IDs are reserved in blocks, so the threads rarely compete for the 
+  object counter. Because the blocks of different threads interleave, 
+  the fanins of a node may have larger IDs than the node itself, so the 
+  fanins are stored as literals rather than as GIA objects. The table 
+  is allocated for the max number of objects and is never resized.
+  The resulting AIG is derived by Gia_HashParDerive().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_HASH_PAR_BLOCK 1024  // the number of object IDs reserved at a time
+
+struct Gia_HashPar_t_
+{
+    int            nCis;          // the number of CIs (object IDs from 1 to nCis)
+    int            nObjsAlloc;    // the max number of objects
+    int            nObjs;         // the number of reserved object IDs (updated atomically)
+    int *          pFanins;       // the fanin literals of each object
+    word *         pTable;        // the hash table (node ID and key in each slot)
+    unsigned       Mask;          // the number of slots minus one
+};
+
+#if defined(_MSC_VER) && !defined(__clang__)
+static inline word Gia_HashParLoad( word * p )                   { return (word)_InterlockedCompareExchange64( (__int64 volatile *)p, 0, 0 );                  }
+static inline word Gia_HashParCas( word * p, word Old, word New ) { return (word)_InterlockedCompareExchange64( (__int64 volatile *)p, (__int64)New, (__int64)Old ); }
+static inline int  Gia_HashParAdd( int * p, int Add )            { return (int)_InterlockedExchangeAdd( (long volatile *)p, Add );                            }
+static inline int  Gia_HashParLoadInt( int * p )                 { return *(int volatile *)p;                                                                 }
+static inline void Gia_HashParStoreInt( int * p, int Value )     { *(int volatile *)p = Value;                                                                }
+#define GIA_HASH_PAR_ATOMIC 1
+#elif defined(__GNUC__)
+static inline word Gia_HashParLoad( word * p )                   { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                             }
+static inline word Gia_HashParCas( word * p, word Old, word New ) { __atomic_compare_exchange_n( p, &Old, New, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ); return Old; }
+static inline int  Gia_HashParAdd( int * p, int Add )            { return __atomic_fetch_add( p, Add, __ATOMIC_RELAXED );                                     }
+static inline int  Gia_HashParLoadInt( int * p )                 { return __atomic_load_n( p, __ATOMIC_RELAXED );                                             }
+static inline void Gia_HashParStoreInt( int * p, int Value )     { __atomic_store_n( p, Value, __ATOMIC_RELAXED );                                            }
+#define GIA_HASH_PAR_ATOMIC 1
+#else
+// without atomic operations, only one thread can be used
+static inline word Gia_HashParLoad( word * p )                   { return *p;                                                                                 }
+static inline word Gia_HashParCas( word * p, word Old, word New ) { word Cur = *p; if ( Cur == Old ) *p = New; return Cur;                                     }
+static inline int  Gia_HashParAdd( int * p, int Add )            { int Cur = *p; *p += Add; return Cur;                                                       }
+static inline int  Gia_HashParLoadInt( int * p )                 { return *p;                                                                                 }
+static inline void Gia_HashParStoreInt( int * p, int Value )     { *p = Value;                                                                                }
+#define GIA_HASH_PAR_ATOMIC 0
+#endif
+
+Gia_HashPar_t * Gia_HashParStart( int nCis, int nObjsMax )
+{
+    Gia_HashPar_t * p = ABC_CALLOC( Gia_HashPar_t, 1 );
+    int nSlots;
+    nObjsMax = Abc_MinInt( nObjsMax, GIA_HASH_SLOT_MAX - 1 );
+    nSlots   = Gia_ManHashSlotsFor( nObjsMax );
+    assert( nCis < nObjsMax );
+    p->nCis       = nCis;
+    p->nObjsAlloc = nObjsMax;
+    p->nObjs      = 1 + nCis;
+    p->pFanins    = ABC_ALLOC( int, 2 * (size_t)nObjsMax );
+    p->pTable     = ABC_CALLOC( word, nSlots );
+    p->Mask       = (unsigned)nSlots - 1;
+    return p;
+}
+void Gia_HashParStop( Gia_HashPar_t * p )
+{
+    ABC_FREE( p->pFanins );
+    ABC_FREE( p->pTable );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds AND node to the concurrent hash table.]
+
+  Description [Can be called by several threads at the same time. Each 
+  thread should pass its own reservation block, initialized to zeros.
+  Literals of the CIs are Abc_Var2Lit(1+i, 0).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_HashParReserve( Gia_HashPar_t * p, Gia_HashRes_t * pRes )
+{
+    if ( pRes->iNext == pRes->iStop )
+    {
+        int iStart = Gia_HashParAdd( &p->nObjs, GIA_HASH_PAR_BLOCK );
+        if ( iStart >= p->nObjsAlloc )
+        {
+            printf( "Gia_HashParAnd(): The number of objects exceeds the limit (%d).\n", p->nObjsAlloc );
+            fflush( stdout );
+            exit( 1 );
+        }
+        pRes->iNext = iStart;
+        pRes->iStop = Abc_MinInt( iStart + GIA_HASH_PAR_BLOCK, p->nObjsAlloc );
+    }
+    return pRes->iNext;
+}
+int Gia_HashParAnd( Gia_HashPar_t * p, Gia_HashRes_t * pRes, int iLit0, int iLit1 )
+{
+    unsigned Key, iSlot;
+    word Slot;
+    int iObj;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = Gia_ManHashKey( iLit0, iLit1, -1 );
+    for ( iSlot = Key & p->Mask; ; iSlot = (iSlot + 1) & p->Mask )
+    {
+        Slot = Gia_HashParLoad( p->pTable + iSlot );
+        if ( Slot == 0 )
+        {
+            // write the node into the reserved ID and try to publish it
+            iObj = Gia_HashParReserve( p, pRes );
+            p->pFanins[2*iObj+0] = iLit0;
+            p->pFanins[2*iObj+1] = iLit1;
+            Slot = Gia_HashParCas( p->pTable + iSlot, 0, ((word)Key << 32) | (unsigned)iObj );
+            if ( Slot == 0 )
+            {
+                pRes->iNext++;
+                return Abc_Var2Lit( iObj, 0 );
+            }
+            // another thread has taken the slot
+        }
+        if ( Gia_ManHashSlotKey(Slot) != Key )
+            continue;
+        iObj = Gia_ManHashId( &Slot );
+        if ( p->pFanins[2*iObj+0] == iLit0 && p->pFanins[2*iObj+1] == iLit1 )
+            return Abc_Var2Lit( iObj, 0 );
+    }
+    assert( 0 );
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the AIG from the concurrent hash table.]
+
+  Description [The array vCopies gives the literal in the table for each 
+  object of the original AIG pOrig (each AND node should be added to the
+  table). Only the nodes in the TFI of the COs are added. The object IDs 
+  assigned by the threads depend on the scheduling, so the objects are 
+  renumbered in the order Gia_ManRehash() would create them: a node is
+  added when the first object of pOrig mapped into it is reached by 
+  Gia_ManForEachObj(). The result is the same as Gia_ManRehash() followed
+  by Gia_ManCleanup(), independently of the number of threads or their
+  timing.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_HashParDerive( Gia_HashPar_t * p, Gia_Man_t * pOrig, Vec_Int_t * vCopies )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int nObjs = Abc_MinInt( p->nObjs, p->nObjsAlloc );
+    Vec_Int_t * vMap   = Vec_IntStartFull( nObjs );
+    Vec_Bit_t * vUsed  = Vec_BitStart( nObjs );
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
+    int i, iObj, iFan0, iFan1, iLit0, iLit1;
+    // mark the nodes in the TFI of the COs
+    Gia_ManForEachCo( pOrig, pObj, i )
+    {
+        Vec_IntPush( vStack, Abc_Lit2Var(Vec_IntEntry(vCopies, Gia_ObjFaninId0p(pOrig, pObj))) );
+        while ( Vec_IntSize(vStack) > 0 )
+        {
+            iObj = Vec_IntPop( vStack );
+            if ( iObj <= p->nCis || Vec_BitEntry(vUsed, iObj) )
+                continue;
+            Vec_BitWriteEntry( vUsed, iObj, 1 );
+            Vec_IntPush( vStack, Abc_Lit2Var(p->pFanins[2*iObj+0]) );
+            Vec_IntPush( vStack, Abc_Lit2Var(p->pFanins[2*iObj+1]) );
+        }
+    }
+    // add the objects in the order of their first appearance
+    pNew = Gia_ManStart( Gia_ManObjNum(pOrig) );
+    Vec_IntWriteEntry( vMap, 0, 0 );
+    Gia_ManForEachObj1( pOrig, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+            Vec_IntWriteEntry( vMap, 1 + Gia_ObjCioId(pObj), Gia_ManAppendCi(pNew) );
+        else if ( Gia_ObjIsCo(pObj) )
+        {
+            iLit0 = Abc_LitNotCond( Vec_IntEntry(vCopies, Gia_ObjFaninId0p(pOrig, pObj)), Gia_ObjFaninC0(pObj) );
+            Gia_ManAppendCo( pNew, Abc_LitNotCond(Vec_IntEntry(vMap, Abc_Lit2Var(iLit0)), Abc_LitIsCompl(iLit0)) );
+        }
+        else if ( Gia_ObjIsAnd(pObj) )
+        {
+            iObj = Abc_Lit2Var( Vec_IntEntry(vCopies, i) );
+            if ( !Vec_BitEntry(vUsed, iObj) || Vec_IntEntry(vMap, iObj) >= 0 )
+                continue;
+            iFan0 = p->pFanins[2*iObj+0];
+            iFan1 = p->pFanins[2*iObj+1];
+            iLit0 = Abc_LitNotCond( Vec_IntEntry(vMap, Abc_Lit2Var(iFan0)), Abc_LitIsCompl(iFan0) );
+            iLit1 = Abc_LitNotCond( Vec_IntEntry(vMap, Abc_Lit2Var(iFan1)), Abc_LitIsCompl(iFan1) );
+            assert( iLit0 >= 0 && iLit1 >= 0 );
+            Vec_IntWriteEntry( vMap, iObj, Gia_ManAppendAnd(pNew, Abc_MinInt(iLit0, iLit1), Abc_MaxInt(iLit0, iLit1)) );
+        }
+    }
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(pOrig) );
+    Vec_IntFree( vMap );
+    Vec_BitFree( vUsed );
+    Vec_IntFree( vStack );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes AIG using several threads.]
+
+  Description [The COs are divided among the tasks. Each task copies the
+  TFI of its COs into the concurrent hash table using the iterative DFS.
+  The shared nodes may be copied by several tasks at the same time, which
+  is safe because they all find the same node in the table. The nodes
+  not in the TFI of the COs are added afterwards by one thread, so the 
+  AIG can be derived in the same order as by Gia_ManRehash().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_RehashTask_t_ Gia_RehashTask_t;
+struct Gia_RehashTask_t_
+{
+    Gia_Man_t *     p;            // the original AIG
+    Gia_HashPar_t * pStr;         // the concurrent hash table
+    int *           pCopies;      // the copies of the objects (shared)
+    int             iCoStart;     // the first CO of this task
+    int             iCoStop;      // the CO after the last one
+};
+static int Gia_ManRehashParTask( void * pArg )
+{
+    Gia_RehashTask_t * pTask = (Gia_RehashTask_t *)pArg;
+    Gia_Man_t * p = pTask->p;
+    int * pCopies = pTask->pCopies;
+    Gia_HashRes_t Res = { 0, 0 };
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
+    Gia_Obj_t * pObj;
+    int k, iObj, iFan0, iFan1, iLit0, iLit1;
+    for ( k = pTask->iCoStart; k < pTask->iCoStop; k++ )
+    {
+        Vec_IntPush( vStack, Gia_ObjFaninId0p(p, Gia_ManCo(p, k)) );
+        while ( Vec_IntSize(vStack) > 0 )
+        {
+            iObj = Vec_IntEntryLast( vStack );
+            if ( Gia_HashParLoadInt(pCopies + iObj) >= 0 )
+            {
+                Vec_IntPop( vStack );
+                continue;
+            }
+            pObj  = Gia_ManObj( p, iObj );
+            assert( Gia_ObjIsAnd(pObj) );
+            iFan0 = Gia_ObjFaninId0( pObj, iObj );
+            iFan1 = Gia_ObjFaninId1( pObj, iObj );
+            iLit0 = Gia_HashParLoadInt( pCopies + iFan0 );
+            iLit1 = Gia_HashParLoadInt( pCopies + iFan1 );
+            if ( iLit0 >= 0 && iLit1 >= 0 )
+            {
+                iLit0 = Abc_LitNotCond( iLit0, Gia_ObjFaninC0(pObj) );
+                iLit1 = Abc_LitNotCond( iLit1, Gia_ObjFaninC1(pObj) );
+                Gia_HashParStoreInt( pCopies + iObj, Gia_HashParAnd(pTask->pStr, &Res, iLit0, iLit1) );
+                Vec_IntPop( vStack );
+                continue;
+            }
+            if ( iLit0 < 0 )
+                Vec_IntPush( vStack, iFan0 );
+            if ( iLit1 < 0 )
+                Vec_IntPush( vStack, iFan1 );
+        }
+    }
+    Vec_IntFree( vStack );
+    return 0;
+}
+Gia_Man_t * Gia_ManRehashPar( Gia_Man_t * p, int nThreads )
+{
+    Gia_Man_t * pNew;
+    Gia_HashPar_t * pStr;
+    Gia_RehashTask_t * pTasks;
+    Util_Sched_t * pSched;
+    Gia_HashRes_t Res = { 0, 0 };
+    Vec_Int_t * vCopies;
+    Gia_Obj_t * pObj;
+    int i, nTasks, nCosPerTask;
+    assert( p->pMuxes == NULL );
+    if ( !GIA_HASH_PAR_ATOMIC )
+        nThreads = 1;
+    // several tasks per thread balance the load
+    nTasks = Abc_MaxInt( 1, Abc_MinInt( 8 * nThreads, Gia_ManCoNum(p) ) );
+    nCosPerTask = (Gia_ManCoNum(p) + nTasks - 1) / nTasks;
+    // each task (and the final pass) may leave a part of its last block of IDs unused
+    pStr    = Gia_HashParStart( Gia_ManCiNum(p), Gia_ManObjNum(p) + GIA_HASH_PAR_BLOCK * (nTasks + 2) );
+    vCopies = Vec_IntStartFull( Gia_ManObjNum(p) );
+    Vec_IntWriteEntry( vCopies, 0, 0 );
+    Gia_ManForEachCi( p, pObj, i )
+        Vec_IntWriteEntry( vCopies, Gia_ObjId(p, pObj), Abc_Var2Lit(1 + i, 0) );
+    pTasks = ABC_CALLOC( Gia_RehashTask_t, nTasks );
+    pSched = Util_SchedStart( nThreads );
+    for ( i = 0; i < nTasks; i++ )
+    {
+        pTasks[i].p        = p;
+        pTasks[i].pStr     = pStr;
+        pTasks[i].pCopies  = Vec_IntArray( vCopies );
+        pTasks[i].iCoStart = Abc_MinInt( i * nCosPerTask, Gia_ManCoNum(p) );
+        pTasks[i].iCoStop  = Abc_MinInt( (i + 1) * nCosPerTask, Gia_ManCoNum(p) );
+        Util_SchedSubmit( pSched, Gia_ManRehashParTask, pTasks + i );
+    }
+    Util_SchedStop( pSched );
+    ABC_FREE( pTasks );
+    // add the dangling nodes, which may come first in the original order
+    Gia_ManForEachAnd( p, pObj, i )
+        if ( Vec_IntEntry(vCopies, i) < 0 )
+        {
+            int iLit0 = Abc_LitNotCond( Vec_IntEntry(vCopies, Gia_ObjFaninId0(pObj, i)), Gia_ObjFaninC0(pObj) );
+            int iLit1 = Abc_LitNotCond( Vec_IntEntry(vCopies, Gia_ObjFaninId1(pObj, i)), Gia_ObjFaninC1(pObj) );
+            Vec_IntWriteEntry( vCopies, i, Gia_HashParAnd(pStr, &Res, iLit0, iLit1) );
+        }
+    // derive the AIG
+    pNew = Gia_HashParDerive( pStr, p, vCopies );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_HashParStop( pStr );
+    Vec_IntFree( vCopies );
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates well-balanced AND gate.]
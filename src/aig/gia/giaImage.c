@@ -0,0 +1,516 @@
+/**CFile****************************************************************
+
+  FileName    [giaImage.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Memory images of the AIG shared between processes.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaImage.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The image is the object array of the manager written as it is in memory,
+// followed by the CI/CO arrays, the MUX controls (if present) and the name.
+// The fanins of the objects are stored as differences of the IDs, so the
+// object array does not contain pointers and can be used where it is mapped.
+// The image is only valid for the binaries with the same object layout.
+// It holds the bare AIG: the managers with names, mapping, boxes or other
+// extensions of the AIGER format are written as AIGER files instead.
+
+#define GIA_IMAGE_MAGIC   "GIAIMG1"
+#define GIA_IMAGE_ALIGN   8
+#define GIA_IMAGE_CHUNK   (1 << 16)  // objects written at a time (keeps the chunks aligned)
+
+typedef struct Gia_ImgHead_t_ Gia_ImgHead_t;
+struct Gia_ImgHead_t_
+{
+    char           Magic[8];      // GIA_IMAGE_MAGIC
+    int            nObjSize;      // the size of one object (sizeof(Gia_Obj_t))
+    int            nObjs;         // the number of objects
+    int            nCis;          // the number of CIs
+    int            nCos;          // the number of COs
+    int            nRegs;         // the number of registers
+    int            nConstrs;      // the number of constraints
+    int            nXors;         // the number of XORs
+    int            nMuxes;        // the number of MUXes
+    int            nBufs;         // the number of buffers
+    int            fMuxes;        // the MUX controls are present
+    int            nName;         // the length of the name (with the terminator)
+    int            fStrash;       // the AIG is structurally hashed and has no dangling nodes
+    int            Reserved[2];   // padding to 64 bytes
+};
+
+static inline word Gia_ImageAlign( word nBytes ) { return (nBytes + GIA_IMAGE_ALIGN - 1) & ~(word)(GIA_IMAGE_ALIGN - 1); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the offsets of the sections of the image.]
+
+  Description [Returns the size of the image.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Gia_ImageOffsets( Gia_ImgHead_t * pHead, word * pOffs )
+{
+    pOffs[0] = Gia_ImageAlign( sizeof(Gia_ImgHead_t) );
+    pOffs[1] = Gia_ImageAlign( pOffs[0] + (word)pHead->nObjSize * pHead->nObjs );
+    pOffs[2] = Gia_ImageAlign( pOffs[1] + sizeof(int) * (word)pHead->nCis );
+    pOffs[3] = Gia_ImageAlign( pOffs[2] + sizeof(int) * (word)pHead->nCos );
+    pOffs[4] = Gia_ImageAlign( pOffs[3] + (pHead->fMuxes ? sizeof(unsigned) * (word)pHead->nObjs : 0) );
+    return pOffs[4] + pHead->nName;
+}
+static int Gia_ImageWriteBytes( FILE * pFile, void * pData, word nBytes, word * pPos )
+{
+    static char Zeros[GIA_IMAGE_ALIGN] = {0};
+    word nPad = Gia_ImageAlign(*pPos) - *pPos;
+    if ( nPad && fwrite( Zeros, 1, (size_t)nPad, pFile ) != nPad )
+        return 0;
+    if ( nBytes && fwrite( pData, 1, (size_t)nBytes, pFile ) != nBytes )
+        return 0;
+    *pPos += nPad + nBytes;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the first extension the image cannot hold.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_ImageExtension( Gia_Man_t * p )
+{
+    if ( p->vNamesIn || p->vNamesOut || p->vNamesNode )
+        return "names";
+    if ( p->pManTime || p->pAigExtra )
+        return "boxes";
+    if ( Gia_ManHasMapping(p) || Gia_ManHasCellMapping(p) || p->vPacking || p->vEdge1 || p->vConfigs )
+        return "mapping";
+    if ( p->vRegInits || p->vInitClasses )
+        return "initial values";
+    if ( p->vFlopClasses || p->vGateClasses || p->vObjClasses || p->vRegClasses )
+        return "object classes";
+    if ( Gia_ManHasChoices(p) || (p->pReprs && p->pNexts) )
+        return "choices";
+    if ( p->pPlacement )
+        return "placement";
+    if ( p->pSwitching )
+        return "switching activity";
+    if ( p->nAnd2Delay )
+        return "AND-gate delay";
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if reading the AIGER file would not change the AIG.]
+
+  Description [This is the case when the AIG has only AND gates, which
+  are structurally hashed, and no dangling nodes.]
+
+  SideEffects [Uses the Value fields of the objects.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ImageIsStrashed( Gia_Man_t * p )
+{
+    Gia_Man_t * pTemp;
+    int RetValue;
+    if ( p->pMuxes || Gia_ManXorNum(p) || Gia_ManBufNum(p) )
+        return 0;
+    pTemp = Gia_ManRehash( p, 0 );
+    RetValue = (Gia_ManAndNum(pTemp) == Gia_ManAndNum(p));
+    Gia_ManStop( pTemp );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the memory image of the AIG into a file.]
+
+  Description [The file can be placed into the shared memory (for example,
+  into /dev/shm on Linux) to be attached by other processes without
+  parsing. The user-controlled fields of the objects (the marks, the 
+  phase and the value) are written as zeros. If the AIG has extensions
+  not stored in the image, the file is written in the AIGER format, 
+  which is also accepted by Gia_AigerRead(). Returns 1 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManImageWrite( Gia_Man_t * p, char * pFileName )
+{
+    Gia_ImgHead_t Head, * pHead = &Head;
+    Gia_Obj_t * pBuffer, * pObj;
+    word pOffs[5], Pos = 0;
+    int i, k, nChunk, RetValue = 1;
+    char * pExt = Gia_ImageExtension( p );
+    FILE * pFile;
+    if ( pExt )
+    {
+        printf( "Gia_ManImageWrite(): The image cannot store the %s of the AIG. Writing AIGER file \"%s\".\n", pExt, pFileName );
+        Gia_AigerWrite( p, pFileName, 0, 0, 0 );
+        return 1;
+    }
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Gia_ManImageWrite(): Cannot open the output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    memset( pHead, 0, sizeof(Gia_ImgHead_t) );
+    memcpy( pHead->Magic, GIA_IMAGE_MAGIC, sizeof(GIA_IMAGE_MAGIC) );
+    pHead->nObjSize = sizeof(Gia_Obj_t);
+    pHead->nObjs    = Gia_ManObjNum(p);
+    pHead->nCis     = Gia_ManCiNum(p);
+    pHead->nCos     = Gia_ManCoNum(p);
+    pHead->nRegs    = Gia_ManRegNum(p);
+    pHead->nConstrs = p->nConstrs;
+    pHead->nXors    = p->nXors;
+    pHead->nMuxes   = p->nMuxes;
+    pHead->nBufs    = p->nBufs;
+    pHead->fMuxes   = (p->pMuxes != NULL);
+    pHead->nName    = p->pName ? strlen(p->pName) + 1 : 0;
+    pHead->fStrash  = Gia_ImageIsStrashed( p );
+    Gia_ImageOffsets( pHead, pOffs );
+    RetValue &= Gia_ImageWriteBytes( pFile, pHead, sizeof(Gia_ImgHead_t), &Pos );
+    pBuffer = ABC_ALLOC( Gia_Obj_t, GIA_IMAGE_CHUNK );
+    for ( i = 0; i < pHead->nObjs; i += nChunk )
+    {
+        nChunk = Abc_MinInt( GIA_IMAGE_CHUNK, pHead->nObjs - i );
+        memcpy( pBuffer, p->pObjs + i, sizeof(Gia_Obj_t) * (size_t)nChunk );
+        for ( k = 0; k < nChunk; k++ )
+        {
+            pObj = pBuffer + k;
+            pObj->fMark0 = pObj->fMark1 = pObj->fPhase = 0;
+            pObj->Value  = 0;
+        }
+        RetValue &= Gia_ImageWriteBytes( pFile, pBuffer, sizeof(Gia_Obj_t) * (word)nChunk, &Pos );
+    }
+    ABC_FREE( pBuffer );
+    RetValue &= Gia_ImageWriteBytes( pFile, Vec_IntArray(p->vCis), sizeof(int) * (word)pHead->nCis, &Pos );
+    RetValue &= Gia_ImageWriteBytes( pFile, Vec_IntArray(p->vCos), sizeof(int) * (word)pHead->nCos, &Pos );
+    if ( p->pMuxes )
+        RetValue &= Gia_ImageWriteBytes( pFile, p->pMuxes, sizeof(unsigned) * (word)pHead->nObjs, &Pos );
+    RetValue &= Gia_ImageWriteBytes( pFile, p->pName, pHead->nName, &Pos );
+    assert( !RetValue || Pos == pOffs[4] + pHead->nName );
+    fclose( pFile );
+    if ( !RetValue )
+        printf( "Gia_ManImageWrite(): Writing the image into file \"%s\" has failed.\n", pFileName );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the file contains the memory image of the AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManImageIsFile( char * pFileName )
+{
+    char Magic[8];
+    FILE * pFile = fopen( pFileName, "rb" );
+    int RetValue;
+    if ( pFile == NULL )
+        return 0;
+    RetValue = fread( Magic, 1, 8, pFile ) == 8 && !memcmp( Magic, GIA_IMAGE_MAGIC, sizeof(GIA_IMAGE_MAGIC) );
+    fclose( pFile );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The mapping is private: the pages are shared with the file
+  and with other processes mapping it until they are modified. If mapping
+  is not available, the file is read into a heap buffer.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_ImageMapFile( char * pFileName, word * pnSize, int * pfMapped )
+{
+    char * pContents = NULL;
+    FILE * pFile;
+    word nSize;
+    *pfMapped = 0;
+#ifndef _WIN32
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd == -1 )
+            return NULL;
+        if ( fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+        {
+            void * pMap = mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+            if ( pMap != MAP_FAILED )
+            {
+                *pnSize = (word)Stat.st_size;
+                *pfMapped = 1;
+                pContents = (char *)pMap;
+            }
+        }
+        close( fd );
+        if ( pContents )
+            return pContents;
+    }
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nSize = (word)ftell( pFile );
+    rewind( pFile );
+    pContents = ABC_ALLOC( char, nSize ? nSize : 1 );
+    if ( fread( pContents, 1, (size_t)nSize, pFile ) != nSize )
+        ABC_FREE( pContents );
+    fclose( pFile );
+    *pnSize = nSize;
+    return pContents;
+}
+static void Gia_ImageUnmap( char * pContents, word nSize, int fMapped )
+{
+#ifndef _WIN32
+    if ( fMapped )
+    {
+        munmap( pContents, (size_t)nSize );
+        return;
+    }
+#endif
+    ABC_FREE( pContents );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the IDs stored in the image.]
+
+  Description [Returns 1 if the CI/CO arrays and the objects agree and
+  all fanins (including MUX controls) point to the preceding objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ImageCheck( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i, Id;
+    if ( !Gia_ObjIsConst0(Gia_ManConst0(p)) || Gia_ManConst0(p)->fTerm )
+        return 0;
+    Vec_IntForEachEntry( p->vCis, Id, i )
+        if ( Id <= 0 || Id >= p->nObjs || !Gia_ObjIsCi(Gia_ManObj(p, Id)) || Gia_ObjCioId(Gia_ManObj(p, Id)) != i )
+            return 0;
+    Vec_IntForEachEntry( p->vCos, Id, i )
+        if ( Id <= 0 || Id >= p->nObjs || !Gia_ObjIsCo(Gia_ManObj(p, Id)) || Gia_ObjCioId(Gia_ManObj(p, Id)) != i )
+            return 0;
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            if ( Gia_ObjCioId(pObj) >= Gia_ManCiNum(p) || Vec_IntEntry(p->vCis, Gia_ObjCioId(pObj)) != i )
+                return 0;
+            continue;
+        }
+        if ( pObj->iDiff0 == 0 || (int)pObj->iDiff0 > i )
+            return 0;
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( Gia_ObjCioId(pObj) >= Gia_ManCoNum(p) || Vec_IntEntry(p->vCos, Gia_ObjCioId(pObj)) != i )
+                return 0;
+            continue;
+        }
+        if ( pObj->iDiff1 == 0 || (int)pObj->iDiff1 > i )
+            return 0;
+        if ( p->pMuxes && p->pMuxes[i] && (int)Abc_Lit2Var(p->pMuxes[i]) >= i )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Attaches the memory image of the AIG.]
+
+  Description [The object array of the resulting manager points into
+  the mapped file; nothing is decoded. Objects modified by the caller
+  (for example, their Value fields) are copied by the OS page by page,
+  so the file and the other processes sharing it are not affected.
+  The small arrays (CIs, COs, MUX controls, the name) are copied into
+  the heap. The manager is released by Gia_ManStop() as usual.
+  Similar to the AIGER reader, unless fGiaSimple or fSkipStrash is set,
+  the AIG is structurally hashed; this only makes a copy if the image 
+  was written from an AIG that is not already hashed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManImageRead( char * pFileName, int fGiaSimple, int fSkipStrash )
+{
+    Gia_ImgHead_t * pHead;
+    Gia_Man_t * p, * pTemp;
+    word pOffs[5], nSize = 0;
+    int fMapped, fStrash;
+    char * pContents = Gia_ImageMapFile( pFileName, &nSize, &fMapped );
+    if ( pContents == NULL )
+    {
+        printf( "Gia_ManImageRead(): Cannot read file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    pHead = (Gia_ImgHead_t *)pContents;
+    if ( nSize < sizeof(Gia_ImgHead_t) || memcmp( pHead->Magic, GIA_IMAGE_MAGIC, sizeof(GIA_IMAGE_MAGIC) ) )
+    {
+        printf( "Gia_ManImageRead(): File \"%s\" does not contain the AIG image.\n", pFileName );
+        Gia_ImageUnmap( pContents, nSize, fMapped );
+        return NULL;
+    }
+    if ( pHead->nObjSize != (int)sizeof(Gia_Obj_t) )
+    {
+        printf( "Gia_ManImageRead(): The image has %d-byte objects while this binary uses %d-byte objects.\n", pHead->nObjSize, (int)sizeof(Gia_Obj_t) );
+        Gia_ImageUnmap( pContents, nSize, fMapped );
+        return NULL;
+    }
+    if ( pHead->nObjs <= 0 || pHead->nCis < 0 || pHead->nCos < 0 || pHead->nCis + pHead->nCos >= pHead->nObjs || 
+         pHead->nRegs < 0 || pHead->nRegs > Abc_MinInt(pHead->nCis, pHead->nCos) || 
+         pHead->nConstrs < 0 || pHead->nConstrs > pHead->nCos - pHead->nRegs || 
+         pHead->nXors < 0 || pHead->nMuxes < 0 || pHead->nBufs < 0 || pHead->nName < 0 ||
+         Gia_ImageOffsets( pHead, pOffs ) != nSize || (pHead->nName && pContents[nSize-1] != '\0') )
+    {
+        printf( "Gia_ManImageRead(): The image in file \"%s\" is corrupted.\n", pFileName );
+        Gia_ImageUnmap( pContents, nSize, fMapped );
+        return NULL;
+    }
+    p = ABC_CALLOC( Gia_Man_t, 1 );
+    p->pObjs      = (Gia_Obj_t *)(pContents + pOffs[0]);
+    p->nObjs      = pHead->nObjs;
+    p->nObjsAlloc = pHead->nObjs;
+    p->vCis       = Vec_IntAllocArrayCopy( (int *)(pContents + pOffs[1]), pHead->nCis );
+    p->vCos       = Vec_IntAllocArrayCopy( (int *)(pContents + pOffs[2]), pHead->nCos );
+    if ( pHead->fMuxes )
+    {
+        p->pMuxes = ABC_ALLOC( unsigned, pHead->nObjs );
+        memcpy( p->pMuxes, pContents + pOffs[3], sizeof(unsigned) * (size_t)pHead->nObjs );
+    }
+    if ( pHead->nName )
+        p->pName = Abc_UtilStrsav( pContents + pOffs[4] );
+    p->pSpec      = Abc_UtilStrsav( pFileName );
+    p->nRegs      = pHead->nRegs;
+    p->nConstrs   = pHead->nConstrs;
+    p->nXors      = pHead->nXors;
+    p->nMuxes     = pHead->nMuxes;
+    p->nBufs      = pHead->nBufs;
+    p->fGiaSimple = fGiaSimple;
+    fStrash       = pHead->fStrash;
+    // the objects are the only part of the image referenced after this point
+    if ( fMapped )
+    {
+        p->pImage     = pContents;
+        p->nImageSize = nSize;
+    }
+    else
+    {
+        p->pObjs = ABC_ALLOC( Gia_Obj_t, pHead->nObjs );
+        memcpy( p->pObjs, pContents + pOffs[0], sizeof(Gia_Obj_t) * (size_t)pHead->nObjs );
+        Gia_ImageUnmap( pContents, nSize, fMapped );
+    }
+    if ( !Gia_ImageCheck( p ) )
+    {
+        printf( "Gia_ManImageRead(): The image in file \"%s\" has invalid object IDs.\n", pFileName );
+        Gia_ManStop( p );
+        return NULL;
+    }
+    if ( !fGiaSimple && !fSkipStrash && !fStrash )
+    {
+        if ( p->pMuxes || Gia_ManXorNum(p) )
+            p = Gia_ManDupNoMuxes( pTemp = p, 1 );
+        else
+            p = Gia_ManRehash( pTemp = p, 0 );
+        p->nConstrs = pTemp->nConstrs;
+        Gia_ManStop( pTemp );
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the objects of the attached image into the heap.]
+
+  Description [Called before the object array is reallocated and when
+  the manager is stopped. If fCopy is 0, the objects are released.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManImageDetach( Gia_Man_t * p, int fCopy )
+{
+    Gia_Obj_t * pObjs = NULL;
+    if ( p->pImage == NULL )
+        return;
+    if ( fCopy )
+    {
+        pObjs = ABC_ALLOC( Gia_Obj_t, p->nObjsAlloc );
+        memcpy( pObjs, p->pObjs, sizeof(Gia_Obj_t) * (size_t)p->nObjsAlloc );
+    }
+    Gia_ImageUnmap( (char *)p->pImage, p->nImageSize, 1 );
+    p->pImage     = NULL;
+    p->nImageSize = 0;
+    p->pObjs      = pObjs;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
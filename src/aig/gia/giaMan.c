@@ -58,6 +58,7 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
 {
     Gia_Man_t * p;
     assert( nObjsMax > 0 );
+    nObjsMax = Abc_MinInt( nObjsMax, GIA_OBJ_MAX );
     p = ABC_CALLOC( Gia_Man_t, 1 );
     p->nObjsAlloc = nObjsMax;
     p->pObjs = ABC_CALLOC( Gia_Obj_t, nObjsMax );
@@ -84,6 +85,7 @@ void Gia_ManStop( Gia_Man_t * p )
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec );
     Gia_ManStaticFanoutStop( p );
+    Gia_ManFaninLitsStop( p );
     Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
     assert( p->pManTime == NULL );
     Vec_PtrFreeFree( p->vNamesIn );
@@ -95,6 +97,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_IntFreeP( &p->vClassNew );
     Vec_IntFreeP( &p->vClassOld );
     Vec_IntFreeP( &p->vPats );
+    Vec_IntFreeP( &p->vProved );
     Vec_BitFreeP( &p->vPolars );
     Vec_WrdFreeP( &p->vSims );
     Vec_WrdFreeP( &p->vSimsT );
@@ -153,8 +156,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Gia_ManStopP( &p->pAigExtra );
     Vec_IntFree( p->vCis );
     Vec_IntFree( p->vCos );
-    Vec_IntErase( &p->vHash );
-    Vec_IntErase( &p->vHTable );
+    Vec_WrdErase( &p->vHTable );
     Vec_IntErase( &p->vRefs );
     Vec_StrFreeP( &p->vStopsF );
     Vec_StrFreeP( &p->vStopsB );    
@@ -174,6 +176,7 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pRefs );
     ABC_FREE( p->pLutRefs );
     ABC_FREE( p->pMuxes );
+    Gia_ManImageDetach( p, 0 );
     ABC_FREE( p->pObjs );
     ABC_FREE( p->pSpec );
     ABC_FREE( p->pName );
@@ -197,8 +200,9 @@ double Gia_ManMemory( Gia_Man_t * p )
     Memory += sizeof(Gia_Obj_t) * Gia_ManObjNum(p);
     Memory += sizeof(int) * Gia_ManCiNum(p);
     Memory += sizeof(int) * Gia_ManCoNum(p);
-    Memory += sizeof(int) * Vec_IntSize(&p->vHTable);
+    Memory += sizeof(word) * Vec_WrdSize(&p->vHTable);
     Memory += sizeof(int) * Gia_ManObjNum(p) * (p->pRefs != NULL);
+    Memory += sizeof(int) * (Vec_IntCap(&p->vFanLits0) + Vec_IntCap(&p->vFanLits1));
     Memory += Vec_IntMemory( p->vLevels );
     Memory += Vec_IntMemory( p->vCellMapping );
     Memory += Vec_IntMemory( &p->vCopies );
@@ -24,6 +24,16 @@
 //#include <immintrin.h>
 #include "aig/miniaig/miniaig.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -106,6 +116,33 @@ static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
         for ( w = 0; w < nWords; w++ )
             pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
 }
+static inline void Gia_ManSimPatSimAndLits( Gia_Man_t * p, int i, int iLit0, int iLit1, int nWords, Vec_Wrd_t * vSims )
+{
+    word pComps[2] = { 0, ~(word)0 };
+    word Diff0 = pComps[Abc_LitIsCompl(iLit0)];
+    word Diff1 = pComps[Abc_LitIsCompl(iLit1)];
+    word * pSims  = Vec_WrdArray(vSims);
+    word * pSims0 = pSims + nWords*Abc_Lit2Var(iLit0);
+    word * pSims1 = pSims + nWords*Abc_Lit2Var(iLit1);
+    word * pSims2 = pSims + nWords*i; int w;
+    if ( Gia_ObjIsXorLits(iLit0, iLit1) )
+        for ( w = 0; w < nWords; w++ )
+            pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+    else
+        for ( w = 0; w < nWords; w++ )
+            pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+}
+static inline void Gia_ManSimPatSimAnds( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims )
+{
+    Gia_Obj_t * pObj;
+    int i, iLit0, iLit1;
+    if ( Gia_ManHasFaninLits(p) )
+        Gia_ManForEachAndLits( p, iLit0, iLit1, i )
+            Gia_ManSimPatSimAndLits( p, i, iLit0, iLit1, nWords, vSims );
+    else
+        Gia_ManForEachAnd( p, pObj, i ) 
+            Gia_ManSimPatSimAnd( p, i, pObj, nWords, vSims );
+}
 static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
     word pComps[2] = { 0, ~(word)0 };
@@ -129,8 +166,7 @@ Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
     Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
     assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, pGia->vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
+    Gia_ManSimPatSimAnds( pGia, nWords, vSims );
     Gia_ManForEachCo( pGia, pObj, i )
         Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
     return vSims;
@@ -143,8 +179,7 @@ Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOut
     Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
     assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
+    Gia_ManSimPatSimAnds( pGia, nWords, vSims );
     Gia_ManForEachCo( pGia, pObj, i )
         Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
     if ( !fOuts )
@@ -572,6 +607,251 @@ Vec_Wrd_t * Gia_ManSimPatSim2( Gia_Man_t * pGia )
     return vSims;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Level-partitioned simulation.]
+
+  Description [Simulates the combinational AIG using the patterns in
+  pGia->vSimsPi. The simulation info is stored in the level-major order,
+  so that the nodes of one level are contiguous in memory, and the nodes
+  of each level are divided among the threads, which wait for each other
+  before the next level. The result has the same layout as the result
+  of Gia_ManSimPatSim().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_SIM_LEV_THR_MAX  100
+#define GIA_SIM_LEV_MIN_WORK (1 << 14) // the min number of words on a level to use the threads
+
+typedef struct Gia_SimLevMan_t_ Gia_SimLevMan_t;
+struct Gia_SimLevMan_t_
+{
+    int              nWords;       // the number of words
+    int              nThreads;     // the number of threads
+    word *           pSims;        // simulation info in the level-major order
+    int *            pFans;        // fanin literals in terms of positions
+    char *           pXors;        // XOR flags
+    int              iBeg;         // the first position of the current level
+    int              iEnd;         // the position following the current level
+    int              iRound;       // the current round
+    int              nDone;        // the number of threads done with this round
+    int              fStop;        // the threads should exit
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;
+    pthread_cond_t   CondStart;
+    pthread_cond_t   CondDone;
+#endif
+};
+typedef struct Gia_SimLevThData_t_ Gia_SimLevThData_t;
+struct Gia_SimLevThData_t_
+{
+    Gia_SimLevMan_t * p;
+    int              iThread;
+};
+
+static inline void Gia_SimLevSimRange( Gia_SimLevMan_t * p, int iBeg, int iEnd )
+{
+    word pComps[2] = { 0, ~(word)0 };
+    int k, w, nWords = p->nWords;
+    for ( k = iBeg; k < iEnd; k++ )
+    {
+        int Lit0 = p->pFans[2*k], Lit1 = p->pFans[2*k+1];
+        word Diff0 = pComps[Abc_LitIsCompl(Lit0)];
+        word Diff1 = pComps[Abc_LitIsCompl(Lit1)];
+        word * pSims0 = p->pSims + (size_t)nWords*Abc_Lit2Var(Lit0);
+        word * pSims1 = p->pSims + (size_t)nWords*Abc_Lit2Var(Lit1);
+        word * pSims2 = p->pSims + (size_t)nWords*k;
+        if ( p->pXors[k] )
+            for ( w = 0; w < nWords; w++ )
+                pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+        else
+            for ( w = 0; w < nWords; w++ )
+                pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+    }
+}
+static inline void Gia_SimLevSimThread( Gia_SimLevMan_t * p, int iThread )
+{
+    int nNodes = p->iEnd - p->iBeg;
+    Gia_SimLevSimRange( p, p->iBeg + iThread * nNodes / p->nThreads, p->iBeg + (iThread + 1) * nNodes / p->nThreads );
+}
+#ifdef ABC_USE_PTHREADS
+void * Gia_SimLevWorkerThread( void * pArg )
+{
+    Gia_SimLevThData_t * pThData = (Gia_SimLevThData_t *)pArg;
+    Gia_SimLevMan_t * p = pThData->p;
+    int iRound = 0;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->iRound == iRound && !p->fStop )
+            pthread_cond_wait( &p->CondStart, &p->Mutex );
+        iRound = p->iRound;
+        if ( p->fStop )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            return NULL;
+        }
+        pthread_mutex_unlock( &p->Mutex );
+        Gia_SimLevSimThread( p, pThData->iThread );
+        pthread_mutex_lock( &p->Mutex );
+        if ( ++p->nDone == p->nThreads - 1 )
+            pthread_cond_signal( &p->CondDone );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return NULL;
+}
+#endif
+Vec_Wrd_t * Gia_ManSimPatSimLevel( Gia_Man_t * pGia, int nProcs )
+{
+    Gia_SimLevMan_t Man, * p = &Man;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vStarts, * vPos, * vFill;
+    Vec_Wrd_t * vSims;
+    int i, k, Id, iPos, nWords, nLevels, nPoses;
+    // without CIs, the number of patterns is not defined
+    if ( Gia_ManCiNum(pGia) == 0 )
+        return Vec_WrdAlloc( 0 );
+    assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+    nWords  = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
+    nLevels = Gia_ManLevelNum( pGia );
+    nPoses  = 1 + Gia_ManCiNum(pGia) + Gia_ManAndNum(pGia);
+    vStarts = Vec_IntStart( nLevels + 2 );
+    vPos    = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    memset( p, 0, sizeof(Gia_SimLevMan_t) );
+    p->nWords   = nWords;
+#ifdef ABC_USE_PTHREADS
+    p->nThreads = Abc_MaxInt( 1, Abc_MinInt(nProcs, GIA_SIM_LEV_THR_MAX) );
+#else
+    p->nThreads = 1;
+#endif
+    // the constant and the CIs are on level 0; level L starts at position vStarts[L]
+    Vec_IntWriteEntry( vStarts, 1, 1 + Gia_ManCiNum(pGia) );
+    Gia_ManForEachAnd( pGia, pObj, i )
+        Vec_IntAddToEntry( vStarts, Gia_ObjLevel(pGia, pObj) + 1, 1 );
+    for ( k = 2; k <= nLevels + 1; k++ )
+        Vec_IntAddToEntry( vStarts, k, Vec_IntEntry(vStarts, k-1) );
+    assert( Vec_IntEntryLast(vStarts) == nPoses );
+    // assign the positions and translate the fanins
+    p->pSims = ABC_CALLOC( word, (size_t)nPoses * nWords );
+    p->pFans = ABC_ALLOC( int, 2 * nPoses );
+    p->pXors = ABC_CALLOC( char, nPoses );
+    Vec_IntWriteEntry( vPos, 0, 0 );
+    Gia_ManForEachCiId( pGia, Id, i )
+    {
+        Vec_IntWriteEntry( vPos, Id, 1 + i );
+        memcpy( p->pSims + (size_t)nWords * (1 + i), Vec_WrdEntryP(pGia->vSimsPi, nWords * i), sizeof(word) * nWords );
+    }
+    vFill = Vec_IntDup( vStarts );
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        iPos = Vec_IntAddToEntry( vFill, Gia_ObjLevel(pGia, pObj), 1 ) - 1;
+        Vec_IntWriteEntry( vPos, i, iPos );
+        p->pFans[2*iPos+0] = Abc_Var2Lit( Vec_IntEntry(vPos, Gia_ObjFaninId0(pObj, i)), Gia_ObjFaninC0(pObj) );
+        p->pFans[2*iPos+1] = Abc_Var2Lit( Vec_IntEntry(vPos, Gia_ObjFaninId1(pObj, i)), Gia_ObjFaninC1(pObj) );
+        p->pXors[iPos]     = Gia_ObjIsXor(pObj);
+    }
+    Vec_IntFree( vFill );
+    // simulate the levels
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 )
+    {
+        Gia_SimLevThData_t ThData[GIA_SIM_LEV_THR_MAX];
+        pthread_t WorkerThread[GIA_SIM_LEV_THR_MAX];
+        int status;
+        pthread_mutex_init( &p->Mutex, NULL );
+        pthread_cond_init( &p->CondStart, NULL );
+        pthread_cond_init( &p->CondDone, NULL );
+        // the calling thread simulates the first part of each level
+        for ( i = 1; i < p->nThreads; i++ )
+        {
+            ThData[i].p       = p;
+            ThData[i].iThread = i;
+            status = pthread_create( WorkerThread + i, NULL, Gia_SimLevWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( k = 1; k <= nLevels; k++ )
+        {
+            p->iBeg = Vec_IntEntry( vStarts, k );
+            p->iEnd = Vec_IntEntry( vStarts, k+1 );
+            if ( (p->iEnd - p->iBeg) * nWords < GIA_SIM_LEV_MIN_WORK )
+            {
+                Gia_SimLevSimRange( p, p->iBeg, p->iEnd );
+                continue;
+            }
+            pthread_mutex_lock( &p->Mutex );
+            p->nDone = 0;
+            p->iRound++;
+            pthread_cond_broadcast( &p->CondStart );
+            pthread_mutex_unlock( &p->Mutex );
+            Gia_SimLevSimThread( p, 0 );
+            pthread_mutex_lock( &p->Mutex );
+            while ( p->nDone < p->nThreads - 1 )
+                pthread_cond_wait( &p->CondDone, &p->Mutex );
+            pthread_mutex_unlock( &p->Mutex );
+        }
+        pthread_mutex_lock( &p->Mutex );
+        p->fStop = 1;
+        pthread_cond_broadcast( &p->CondStart );
+        pthread_mutex_unlock( &p->Mutex );
+        for ( i = 1; i < p->nThreads; i++ )
+            pthread_join( WorkerThread[i], NULL );
+        pthread_cond_destroy( &p->CondDone );
+        pthread_cond_destroy( &p->CondStart );
+        pthread_mutex_destroy( &p->Mutex );
+    }
+    else
+#endif
+    Gia_SimLevSimRange( p, 1 + Gia_ManCiNum(pGia), nPoses );
+    // copy the simulation info into the object order
+    vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
+    Gia_ManForEachObj1( pGia, pObj, i )
+        if ( !Gia_ObjIsCo(pObj) )
+            memcpy( Vec_WrdEntryP(vSims, nWords * i), p->pSims + (size_t)nWords * Vec_IntEntry(vPos, i), sizeof(word) * nWords );
+    Gia_ManForEachCo( pGia, pObj, i )
+        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    ABC_FREE( p->pSims );
+    ABC_FREE( p->pFans );
+    ABC_FREE( p->pXors );
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vPos );
+    return vSims;
+}
+void Gia_ManSimPatSimLevelTest( Gia_Man_t * pGia, int nWords, int nProcs, int fVerbose )
+{
+    Vec_Wrd_t * vSimsPi = pGia->vSimsPi, * vSims[2];
+    abctime clk, clkSerial, clkLevel;
+    if ( Gia_ManCiNum(pGia) == 0 )
+    {
+        printf( "The AIG has no CIs to simulate.\n" );
+        return;
+    }
+    if ( vSimsPi == NULL )
+    {
+        Abc_Random( 1 );
+        pGia->vSimsPi = Vec_WrdStartRandom( Gia_ManCiNum(pGia) * nWords );
+    }
+    clk = Abc_Clock();
+    vSims[0]  = Gia_ManSimPatSim( pGia );
+    clkSerial = Abc_Clock() - clk;
+    clk = Abc_Clock();
+    vSims[1]  = Gia_ManSimPatSimLevel( pGia, nProcs );
+    clkLevel  = Abc_Clock() - clk;
+    printf( "Simulated %d nodes on %d levels with %d patterns using %d threads.  ",
+        Gia_ManAndNum(pGia), Gia_ManLevelNum(pGia), 64 * (Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia)), nProcs );
+    if ( Vec_WrdEqual(vSims[0], vSims[1]) )
+        printf( "The results are identical.\n" );
+    else
+        printf( "The results are DIFFERENT.\n" );
+    Abc_PrintTime( 1, "Serial simulation   ", clkSerial );
+    Abc_PrintTime( 1, "Levelized simulation", clkLevel );
+    Vec_WrdFree( vSims[0] );
+    Vec_WrdFree( vSims[1] );
+    if ( vSimsPi == NULL )
+        Vec_WrdFreeP( &pGia->vSimsPi );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
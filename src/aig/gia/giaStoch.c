@@ -100,14 +100,17 @@ void Gia_StochProcessArray( Vec_Ptr_t * vGias, char * pScript, int TimeSecs, int
 
   Synopsis    [Processing on many cores.]
 
-  Description []
+  Description [If the script is thread-safe (Cmd_CommandIsThreadSafe), 
+  it is executed in a private frame of the calling thread. Otherwise,
+  it is executed by a separate ABC process, which reads and writes
+  the AIG using a file whose name is derived from Rand.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_StochProcessOne( Gia_Man_t * p, char * pScript, int Rand, int TimeSecs )
+Gia_Man_t * Gia_StochProcessOneProc( Gia_Man_t * p, char * pScript, int Rand )
 {
     Gia_Man_t * pNew;
     char FileName[100], Command[1000];
@@ -134,6 +137,24 @@ Gia_Man_t * Gia_StochProcessOne( Gia_Man_t * p, char * pScript, int Rand, int Ti
     Gia_ManStopP( &pNew );
     return Gia_ManDup(p);
 }
+Gia_Man_t * Gia_StochProcessOne( Gia_Man_t * p, char * pScript, int Rand, int fThreads )
+{
+    Gia_Man_t * pNew = NULL, * pTemp;
+    Abc_Frame_t * pAbc;
+    char * pCommand;
+    if ( !fThreads )
+        return Gia_StochProcessOneProc( p, pScript, Rand );
+    pAbc = Abc_FrameStartLocal();
+    pCommand = Abc_UtilStrsav( pScript );
+    Abc_FrameUpdateGia( pAbc, Gia_ManDup(p) );
+    if ( Cmd_CommandExecute( pAbc, pCommand ) )
+        Abc_Print( 1, "Something did not work out with the command \"%s\".\n", pScript );
+    else if ( (pTemp = Abc_FrameReadGia(pAbc)) && Gia_ManAndNum(pTemp) < Gia_ManAndNum(p) )
+        pNew = Gia_ManDup( pTemp );
+    Abc_FrameStopLocal( pAbc );
+    ABC_FREE( pCommand );
+    return pNew ? pNew : Gia_ManDup(p);
+}
 
 /**Function*************************************************************
 
@@ -153,7 +174,7 @@ typedef struct StochSynData_t_
     Gia_Man_t *  pOut;
     char *       pScript;
     int          Rand;
-    int          TimeOut;
+    int          fThreads;
 } StochSynData_t;
 
 int Gia_StochProcess1( void * p )
@@ -161,7 +182,7 @@ int Gia_StochProcess1( void * p )
     StochSynData_t * pData = (StochSynData_t *)p;
     assert( pData->pIn != NULL );
     assert( pData->pOut == NULL );
-    pData->pOut = Gia_StochProcessOne( pData->pIn, pData->pScript, pData->Rand, pData->TimeOut );
+    pData->pOut = Gia_StochProcessOne( pData->pIn, pData->pScript, pData->Rand, pData->fThreads );
     return 1;
 }
 
@@ -176,18 +197,20 @@ void Gia_StochProcess( Vec_Ptr_t * vGias, char * pScript, int nProcs, int TimeSe
     StochSynData_t * pData = ABC_CALLOC( StochSynData_t, Vec_PtrSize(vGias) );
     Vec_Ptr_t * vData = Vec_PtrAlloc( Vec_PtrSize(vGias) ); 
     Gia_Man_t * pGia; int i;
+    // the scripts that are not thread-safe are run by separate processes
+    int fThreads = Cmd_CommandIsThreadSafe( Abc_FrameGetGlobalFrame(), pScript );
     Abc_Random(1);
     Vec_PtrForEachEntry( Gia_Man_t *, vGias, pGia, i ) {
         pData[i].pIn     = pGia;
         pData[i].pOut    = NULL;
         pData[i].pScript = pScript;
         pData[i].Rand    = Abc_Random(0) % 0x1000000;
-        pData[i].TimeOut = TimeSecs;
+        pData[i].fThreads = fThreads;
         Vec_PtrPush( vData, pData+i );
     }
     if ( fVerbose )
-        printf( "Running concurrent synthesis with %d processes.\n", nProcs ), fflush(stdout);
-    Util_ProcessThreads( Gia_StochProcess1, vData, nProcs, TimeSecs, fVerbose );
+        printf( "Running concurrent synthesis with %d %s.\n", nProcs, fThreads ? "threads" : "processes" ), fflush(stdout);
+    Util_ProcessThreads( Gia_StochProcess1, vData, nProcs, fVerbose );
     // replace old AIGs by new AIGs
     Vec_PtrForEachEntry( Gia_Man_t *, vGias, pGia, i ) {
         Gia_ManStop( pGia );
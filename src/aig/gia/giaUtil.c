@@ -532,6 +532,47 @@ void Gia_ManCleanTruth( Gia_Man_t * p )
     Vec_IntFill( p->vTruths, Gia_ManObjNum(p), -1 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Builds the structure-of-arrays view of the fanins.]
+
+  Description [Stores the fanin literals of each object in two separate
+  arrays (vFanLits0 and vFanLits1), so that traversals needing only
+  the fanins do not load the whole object. The missing fanins are -1:
+  both are -1 for the constant and the CIs, the second one is -1 for
+  the COs. Once started, the view is extended by Gia_ManAppendCi(),
+  Gia_ManAppendAnd(), Gia_ManAppendXorReal() and the other append 
+  functions, and updated by Gia_ManPatchCoDriver(). Code changing the 
+  fanins of existing objects in any other way should stop the view.
+  If the view falls behind the objects, Gia_ManHasFaninLits() returns
+  0 and the kernels use the objects; calling this procedure again adds
+  the missing objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManFaninLitsStart( Gia_Man_t * p )  
+{
+    Gia_Obj_t * pObj;
+    int i = Vec_IntSize(&p->vFanLits0);
+    assert( i == Vec_IntSize(&p->vFanLits1) && i <= Gia_ManObjNum(p) );
+    Vec_IntGrow( &p->vFanLits0, Gia_ManObjNum(p) );
+    Vec_IntGrow( &p->vFanLits1, Gia_ManObjNum(p) );
+    for ( ; i < Gia_ManObjNum(p); i++ )
+    {
+        pObj = Gia_ManObj( p, i );
+        Vec_IntPush( &p->vFanLits0, Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) ? Gia_ObjFaninLit0(pObj, i) : -1 );
+        Vec_IntPush( &p->vFanLits1, Gia_ObjIsAnd(pObj) ? Gia_ObjFaninLit1(pObj, i) : -1 );
+    }
+}
+void Gia_ManFaninLitsStop( Gia_Man_t * p )  
+{
+    Vec_IntErase( &p->vFanLits0 );
+    Vec_IntErase( &p->vFanLits1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Assigns levels.]
@@ -543,12 +584,37 @@ void Gia_ManCleanTruth( Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
+static int Gia_ManLevelNumLits( Gia_Man_t * p )  
+{
+    int * pLits0 = Vec_IntArray( &p->vFanLits0 );
+    int * pLits1 = Vec_IntArray( &p->vFanLits1 );
+    int * pLevels = Vec_IntArray( p->vLevels );
+    int i, iLit0, iLit1, Level;
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+    {
+        iLit0 = pLits0[i];
+        iLit1 = pLits1[i];
+        if ( iLit1 < 0 ) // CO, CI or const0
+            Level = iLit0 < 0 ? 0 : pLevels[Abc_Lit2Var(iLit0)];
+        else if ( !p->fGiaSimple && Gia_ObjIsBufLits(iLit0, iLit1) )
+            Level = pLevels[Abc_Lit2Var(iLit0)];
+        else if ( Gia_ObjIsMuxId(p, i) )
+            Level = 2 + Abc_MaxInt( Abc_MaxInt(pLevels[Abc_Lit2Var(iLit0)], pLevels[Abc_Lit2Var(iLit1)]), pLevels[Abc_Lit2Var(p->pMuxes[i])] );
+        else 
+            Level = 1 + Gia_ObjIsXorLits(iLit0, iLit1) + Abc_MaxInt( pLevels[Abc_Lit2Var(iLit0)], pLevels[Abc_Lit2Var(iLit1)] );
+        pLevels[i] = Level;
+        p->nLevels = Abc_MaxInt( p->nLevels, Level );
+    }
+    return p->nLevels;
+}
 int Gia_ManLevelNum( Gia_Man_t * p )  
 {
     Gia_Obj_t * pObj;
     int i;
     Gia_ManCleanLevels( p, Gia_ManObjNum(p) );
     p->nLevels = 0;
+    if ( Gia_ManHasFaninLits(p) )
+        return Gia_ManLevelNumLits( p );
     Gia_ManForEachObj( p, pObj, i )
     {
         if ( !p->fGiaSimple && Gia_ObjIsBuf(pObj) )
@@ -779,9 +845,27 @@ void Gia_ManCreateValueRefs( Gia_Man_t * p )
 void Gia_ManCreateRefs( Gia_Man_t * p )  
 {
     Gia_Obj_t * pObj;
-    int i;
+    int i, iLit0, iLit1;
     assert( p->pRefs == NULL );
     p->pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    if ( Gia_ManHasFaninLits(p) )
+    {
+        int * pLits0 = Vec_IntArray( &p->vFanLits0 );
+        int * pLits1 = Vec_IntArray( &p->vFanLits1 );
+        for ( i = 0; i < Gia_ManObjNum(p); i++ )
+        {
+            if ( (iLit0 = pLits0[i]) < 0 )
+                continue;
+            p->pRefs[Abc_Lit2Var(iLit0)]++;
+            if ( (iLit1 = pLits1[i]) < 0 )
+                continue;
+            if ( !Gia_ObjIsBufLits(iLit0, iLit1) )
+                p->pRefs[Abc_Lit2Var(iLit1)]++;
+            if ( Gia_ObjIsMuxId(p, i) )
+                p->pRefs[Abc_Lit2Var(p->pMuxes[i])]++;
+        }
+        return;
+    }
     Gia_ManForEachObj( p, pObj, i )
     {
         if ( Gia_ObjIsAnd(pObj) )
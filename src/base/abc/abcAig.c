@@ -664,6 +664,56 @@ void Abc_AigRehash( Abc_Aig_t * pMan )
     pMan->pBins = pBinsNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Rebuilds the hash table from the nodes of the AIG.]
+
+  Description [Used after the objects of the AIG have been relocated, 
+  when the table still points to the old objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_AigRebuildTable( Abc_Aig_t * pMan )
+{
+    Abc_Obj_t * pEnt;
+    int * pArray;
+    unsigned Key;
+    int Temp, i;
+    pMan->pConst1 = Abc_NtkObj( pMan->pNtkAig, 0 );
+    assert( Abc_ObjType(pMan->pConst1) == ABC_OBJ_CONST1 );
+    memset( pMan->pBins, 0, sizeof(Abc_Obj_t *) * pMan->nBins );
+    pMan->nEntries = 0;
+    Abc_NtkForEachNode( pMan->pNtkAig, pEnt, i )
+    {
+        // swap the fanins if needed
+        pArray = pEnt->vFanins.pArray;
+        if ( pArray[0] > pArray[1] )
+        {
+            Temp = pArray[0];
+            pArray[0] = pArray[1];
+            pArray[1] = Temp;
+            Temp = pEnt->fCompl0;
+            pEnt->fCompl0 = pEnt->fCompl1;
+            pEnt->fCompl1 = Temp;
+        }
+        Key = Abc_HashKey2( Abc_ObjChild0(pEnt), Abc_ObjChild1(pEnt), pMan->nBins );
+        pEnt->pNext = pMan->pBins[Key];
+        pMan->pBins[Key] = pEnt;
+        pMan->nEntries++;
+    }
+    // the temporary arrays should not point to the old objects
+    Vec_PtrClear( pMan->vNodes );
+    Vec_PtrClear( pMan->vStackReplaceOld );
+    Vec_PtrClear( pMan->vStackReplaceNew );
+    if ( pMan->vAddedCells )
+        Vec_PtrClear( pMan->vAddedCells );
+    if ( pMan->vUpdatedNets )
+        Vec_PtrClear( pMan->vUpdatedNets );
+}
+
 
 
 
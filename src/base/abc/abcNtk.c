@@ -1361,6 +1361,174 @@ Abc_Ntk_t * Abc_NtkCreateWithNodes( Vec_Ptr_t * vSop )
     return pNtkNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Renumbers the objects and relocates them for locality.]
+
+  Description [The objects are ordered as follows: the constant (for AIGs),
+  the PIs, the POs, the boxes with their inputs and outputs, the internal 
+  nodes in the DFS order, and the remaining objects. The objects and 
+  their fanin/fanout arrays are copied in this order into new memory 
+  managers and the old managers are freed, which releases the memory of 
+  the deleted objects and of the arrays left behind by the fanout growth.
+  The names, the AIG hash table, the reverse levels, the fanin phases and 
+  the timing information are updated. The object pointers change, so the 
+  caller should not keep them across this call; pCopy and pNext are reset.
+  Returns 0 (and does nothing) if the network has choices, or data indexed 
+  by the object IDs or pointing to the objects that cannot be remapped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_NtkCompactArray( Mem_Step_t * pMmStep, Vec_Int_t * vNew, Vec_Int_t * vOld, int * pMap )
+{
+    int i;
+    // keep the invariant of Vec_IntPushMem(): the capacity is a power of two
+    vNew->nSize  = vOld->nSize;
+    vNew->nCap   = vOld->nSize ? Abc_MaxInt( 2, 1 << Abc_Base2Log(vOld->nSize) ) : 0;
+    vNew->pArray = NULL;
+    if ( vNew->nCap == 0 )
+        return;
+    if ( pMmStep )
+        vNew->pArray = (int *)Mem_StepEntryFetch( pMmStep, vNew->nCap * 4 );
+    else
+        vNew->pArray = ABC_ALLOC( int, vNew->nCap );
+    for ( i = 0; i < vOld->nSize; i++ )
+        vNew->pArray[i] = pMap[vOld->pArray[i]];
+}
+static Vec_Int_t * Abc_NtkCompactRemap( Vec_Int_t * vOld, int * pMap, int nObjsOld, int nObjsNew )
+{
+    Vec_Int_t * vNew = Vec_IntStart( nObjsNew );
+    int i, Entry;
+    // the array may be longer than the number of objects
+    Vec_IntForEachEntryStop( vOld, Entry, i, Abc_MinInt(Vec_IntSize(vOld), nObjsOld) )
+        if ( pMap[i] >= 0 )
+            Vec_IntWriteEntry( vNew, pMap[i], Entry );
+    Vec_IntFree( vOld );
+    return vNew;
+}
+static void Abc_NtkCompactAddObj( Vec_Ptr_t * vOrder, int * pMap, Abc_Obj_t * pObj )
+{
+    if ( pMap[pObj->Id] >= 0 )
+        return;
+    pMap[pObj->Id] = Vec_PtrSize( vOrder );
+    Vec_PtrPush( vOrder, pObj );
+}
+int Abc_NtkCompact( Abc_Ntk_t * pNtk )
+{
+    Mem_Fixed_t * pMmObj;
+    Mem_Step_t * pMmStep;
+    Nm_Man_t * pManName;
+    Vec_Ptr_t * vOrder, * vNodes, * vObjsNew;
+    Vec_Ptr_t * pVecs[6] = { pNtk->vPis, pNtk->vPos, pNtk->vCis, pNtk->vCos, pNtk->vPios, pNtk->vBoxes };
+    Abc_Obj_t * pObj, * pNew, * pTemp, ** ppNew;
+    int * pMap, nObjsOld = Abc_NtkObjNumMax(pNtk);
+    int i, k;
+    char * pName;
+    void * pAttr;
+    assert( Abc_NtkIsStrash(pNtk) || Abc_NtkIsLogic(pNtk) );
+    if ( Abc_NtkIsStrash(pNtk) && Abc_NtkGetChoiceNum(pNtk) )
+        return 0;
+    if ( pNtk->pManCut || pNtk->vObjPerm || pNtk->vTopo || pNtk->vNameIds || pNtk->vFins || pNtk->vOrigNodeIds )
+        return 0;
+    if ( pNtk->vGates || pNtk->pLutTimes || pNtk->vSupps )
+        return 0;
+    if ( pNtk->vAttrs )
+        Vec_PtrForEachEntry( void *, pNtk->vAttrs, pAttr, i )
+            if ( pAttr != NULL )
+                return 0;
+    // collect the objects in the new order
+    pMap   = ABC_FALLOC( int, nObjsOld );
+    vOrder = Vec_PtrAlloc( pNtk->nObjs );
+    if ( Abc_NtkIsStrash(pNtk) )
+        Abc_NtkCompactAddObj( vOrder, pMap, Abc_AigConst1(pNtk) );
+    Abc_NtkForEachPi( pNtk, pObj, i )
+        Abc_NtkCompactAddObj( vOrder, pMap, pObj );
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        Abc_NtkCompactAddObj( vOrder, pMap, pObj );
+    Abc_NtkForEachBox( pNtk, pObj, i )
+    {
+        Abc_NtkCompactAddObj( vOrder, pMap, pObj );
+        Abc_ObjForEachFanin( pObj, pTemp, k )
+            Abc_NtkCompactAddObj( vOrder, pMap, pTemp );
+        Abc_ObjForEachFanout( pObj, pTemp, k )
+            Abc_NtkCompactAddObj( vOrder, pMap, pTemp );
+    }
+    vNodes = Abc_NtkIsStrash(pNtk) ? Abc_AigDfs( pNtk, 1, 0 ) : Abc_NtkDfs( pNtk, 1 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+        Abc_NtkCompactAddObj( vOrder, pMap, pObj );
+    Vec_PtrFree( vNodes );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        Abc_NtkCompactAddObj( vOrder, pMap, pObj );
+    assert( Vec_PtrSize(vOrder) == pNtk->nObjs );
+    // copy the objects into the new memory
+    pMmObj   = pNtk->pMmObj  ? Mem_FixedStart( sizeof(Abc_Obj_t) ) : NULL;
+    pMmStep  = pNtk->pMmStep ? Mem_StepStart( ABC_NUM_STEPS )      : NULL;
+    ppNew    = ABC_CALLOC( Abc_Obj_t *, nObjsOld );
+    vObjsNew = Vec_PtrAlloc( Vec_PtrSize(vOrder) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vOrder, pObj, i )
+    {
+        pNew = pMmObj ? (Abc_Obj_t *)Mem_FixedEntryFetch( pMmObj ) : ABC_ALLOC( Abc_Obj_t, 1 );
+        *pNew = *pObj;
+        pNew->Id    = i;
+        pNew->pNext = NULL;
+        pNew->pCopy = NULL;
+        Abc_NtkCompactArray( pMmStep, &pNew->vFanins,  &pObj->vFanins,  pMap );
+        Abc_NtkCompactArray( pMmStep, &pNew->vFanouts, &pObj->vFanouts, pMap );
+        ppNew[pObj->Id] = pNew;
+        Vec_PtrPush( vObjsNew, pNew );
+    }
+    // transfer the names
+    if ( pNtk->pManName )
+    {
+        pManName = Nm_ManCreate( Abc_MaxInt(200, Nm_ManNumEntries(pNtk->pManName)) );
+        Vec_PtrForEachEntry( Abc_Obj_t *, vOrder, pObj, i )
+            if ( (pName = Nm_ManFindNameById(pNtk->pManName, pObj->Id)) )
+                Nm_ManStoreIdName( pManName, i, pObj->Type, pName, NULL );
+        Nm_ManFree( pNtk->pManName );
+        pNtk->pManName = pManName;
+    }
+    // update the arrays of objects
+    for ( k = 0; k < 6; k++ )
+        Vec_PtrForEachEntry( Abc_Obj_t *, pVecs[k], pObj, i )
+            Vec_PtrWriteEntry( pVecs[k], i, ppNew[pObj->Id] );
+    // free the old objects
+    if ( pNtk->pMmStep == NULL )
+        Vec_PtrForEachEntry( Abc_Obj_t *, vOrder, pObj, i )
+        {
+            ABC_FREE( pObj->vFanouts.pArray );
+            ABC_FREE( pObj->vFanins.pArray );
+        }
+    if ( pNtk->pMmObj == NULL )
+        Vec_PtrForEachEntry( Abc_Obj_t *, vOrder, pObj, i )
+            ABC_FREE( pObj );
+    if ( pNtk->pMmObj )
+        Mem_FixedStop( pNtk->pMmObj, 0 );
+    if ( pNtk->pMmStep )
+        Mem_StepStop( pNtk->pMmStep, 0 );
+    pNtk->pMmObj  = pMmObj;
+    pNtk->pMmStep = pMmStep;
+    Vec_PtrFree( pNtk->vObjs );
+    pNtk->vObjs = vObjsNew;
+    // update the data indexed by the object IDs
+    ABC_FREE( pNtk->vTravIds.pArray );
+    pNtk->vTravIds.nSize = pNtk->vTravIds.nCap = 0;
+    if ( pNtk->vLevelsR )
+        pNtk->vLevelsR = Abc_NtkCompactRemap( pNtk->vLevelsR, pMap, nObjsOld, Vec_PtrSize(vObjsNew) );
+    if ( pNtk->vPhases )
+        pNtk->vPhases = Abc_NtkCompactRemap( pNtk->vPhases, pMap, nObjsOld, Vec_PtrSize(vObjsNew) );
+    if ( pNtk->pManTime )
+        Abc_NtkTimeRemapIds( pNtk, pMap, nObjsOld, Vec_PtrSize(vObjsNew) );
+    if ( Abc_NtkIsStrash(pNtk) )
+        Abc_AigRebuildTable( (Abc_Aig_t *)pNtk->pManFunc );
+    Vec_PtrFree( vOrder );
+    ABC_FREE( ppNew );
+    ABC_FREE( pMap );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Deletes the Ntk.]
@@ -86,6 +86,12 @@ void Abc_ObjRecycle( Abc_Obj_t * pObj )
         ABC_FREE( pObj->vFanouts.pArray );
         ABC_FREE( pObj->vFanins.pArray );
     }
+    else
+    {
+        // return the arrays to the manager to be reused by other objects
+        Mem_StepEntryRecycle( pNtk->pMmStep, (char *)pObj->vFanouts.pArray, pObj->vFanouts.nCap * 4 );
+        Mem_StepEntryRecycle( pNtk->pMmStep, (char *)pObj->vFanins.pArray,  pObj->vFanins.nCap * 4 );
+    }
     // clean the memory to make deleted object distinct from the live one
     memset( pObj, 0, sizeof(Abc_Obj_t) );
     // recycle the object
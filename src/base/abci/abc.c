@@ -44,6 +44,7 @@
 #include "opt/ret/retInt.h"
 #include "sat/xsat/xsat.h"
 #include "sat/satoko/satoko.h"
+#include "sat/bsat/satBackend.h"
 #include "sat/cnf/cnf.h"
 #include "proof/cec/cec.h"
 #include "proof/acec/acec.h"
@@ -118,6 +119,7 @@ static int Abc_CommandMulti                  ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandRenode                 ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandCleanup                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandSweep                  ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandCompact                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandFastExtract            ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandFxch                   ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandEliminate              ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -451,6 +453,7 @@ static int Abc_CommandAbc9ReadSim            ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9WriteSim           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9PrintSim           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9GenSim             ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9LevSim             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SimRsb             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Resim              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SpecI              ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -936,6 +939,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "Synthesis",    "renode",        Abc_CommandRenode,           1 );
     Cmd_CommandAdd( pAbc, "Synthesis",    "cleanup",       Abc_CommandCleanup,          1 );
     Cmd_CommandAdd( pAbc, "Synthesis",    "sweep",         Abc_CommandSweep,            1 );
+    Cmd_CommandAdd( pAbc, "Synthesis",    "compact",       Abc_CommandCompact,          1 );
     Cmd_CommandAdd( pAbc, "Synthesis",    "fx",            Abc_CommandFastExtract,      1 );
     Cmd_CommandAdd( pAbc, "Synthesis",    "fxch",          Abc_CommandFxch,             1 );
     Cmd_CommandAdd( pAbc, "Synthesis",    "eliminate",     Abc_CommandEliminate,        1 );
@@ -1268,6 +1272,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim_write",    Abc_CommandAbc9WriteSim,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim_print",    Abc_CommandAbc9PrintSim,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim_gen",      Abc_CommandAbc9GenSim,       0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&sim_lev",      Abc_CommandAbc9LevSim,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&simrsb",       Abc_CommandAbc9SimRsb,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&resim",        Abc_CommandAbc9Resim,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&speci",        Abc_CommandAbc9SpecI,        0 );
@@ -1503,34 +1508,32 @@ void Abc_End( Abc_Frame_t * pAbc )
 {
     extern Abc_Frame_t * Abc_FrameGetGlobalFrame();
     Abc_FrameClearDesign();
-    Cnf_ManFree();
+    // the global managers are shared with the private frames of the threads
+    if ( !pAbc->fThreadLocal )
     {
         extern int Abc_NtkCompareAndSaveBest( Abc_Ntk_t * pNtk );
-        Abc_NtkCompareAndSaveBest( NULL );
-    }
-    {
         extern void Dar_LibStop();
-        Dar_LibStop();
-    }
-    {
         extern void Aig_RManQuit();
-        Aig_RManQuit();
-    }
-    {
         extern void Npn_ManClean();
+        extern void Sdm_ManQuit();
+        Cnf_ManFree();
+        Abc_NtkCompareAndSaveBest( NULL );
+        Aig_RManQuit();
         Npn_ManClean();
+        Sdm_ManQuit();
+        Abc_NtkFraigStoreClean();
     }
     {
-        extern void Sdm_ManQuit();
-        Sdm_ManQuit();
+        // the rewriting library belongs to the calling thread
+        extern void Dar_LibStop();
+        Dar_LibStop();
     }
-    Abc_NtkFraigStoreClean();
     Gia_ManStopP( &pAbc->pGia );
     Gia_ManStopP( &pAbc->pGia2 );
     Gia_ManStopP( &pAbc->pGiaBest );
     Gia_ManStopP( &pAbc->pGiaBest2 );
     Gia_ManStopP( &pAbc->pGiaSaved );
-    if ( Abc_NtkRecIsRunning3() )
+    if ( !pAbc->fThreadLocal && Abc_NtkRecIsRunning3() )
         Abc_NtkRecStop3();
 }
 
@@ -4443,6 +4446,67 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandCompact( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
+    int c, nMemBefore, nMemAfter;
+    int fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pNtk == NULL )
+    {
+        Abc_Print( -1, "Empty network.\n" );
+        return 1;
+    }
+    if ( !Abc_NtkIsStrash(pNtk) && !Abc_NtkIsLogic(pNtk) )
+    {
+        Abc_Print( -1, "Compacting works only for logic networks and AIGs.\n" );
+        return 1;
+    }
+    nMemBefore = (pNtk->pMmObj ? Mem_FixedReadMemUsage(pNtk->pMmObj) : 0) + (pNtk->pMmStep ? Mem_StepReadMemUsage(pNtk->pMmStep) : 0);
+    if ( !Abc_NtkCompact( pNtk ) )
+    {
+        Abc_Print( -1, "The network has choices or other data that prevent compacting.\n" );
+        return 1;
+    }
+    nMemAfter = (pNtk->pMmObj ? Mem_FixedReadMemUsage(pNtk->pMmObj) : 0) + (pNtk->pMmStep ? Mem_StepReadMemUsage(pNtk->pMmStep) : 0);
+    if ( fVerbose )
+        Abc_Print( 1, "Objects = %d. Memory of objects and fanin/fanout arrays: %.2f MB -> %.2f MB.\n", 
+            Abc_NtkObjNum(pNtk), 1.0*nMemBefore/(1<<20), 1.0*nMemAfter/(1<<20) );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: compact [-vh]\n" );
+    Abc_Print( -2, "\t        renumbers the objects in the DFS order and moves them\n" );
+    Abc_Print( -2, "\t        with their fanin/fanout arrays into contiguous memory\n" );
+    Abc_Print( -2, "\t-v    : print verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h    : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -28205,6 +28269,7 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     int nLearnedDelta;
     int nLearnedPerce;
     int nInsLimit;
+    int nThreads;
     abctime clk;
 
     extern int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fVerbose );
@@ -28220,8 +28285,9 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     nLearnedStart = 0;
     nLearnedDelta = 0;
     nLearnedPerce = 0;
+    nThreads   = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CILDEpansvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CILDEPpansvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -28280,6 +28346,17 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nLearnedPerce < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads <= 0 )
+                goto usage;
+            break;
         case 'p':
             fAlignPol ^= 1;
             break;
@@ -28353,7 +28430,9 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 0;
     }
     clk = Abc_Clock();
+    Cnf_ManSetThreadNum( nThreads );
     RetValue = Abc_NtkDSat( pNtk, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fAlignPol, fAndOuts, fNewSolver, fVerbose );
+    Cnf_ManSetThreadNum( 1 );
     // verify that the pattern is correct
     if ( RetValue == 0 && Abc_NtkPoNum(pNtk) == 1 )
     {
@@ -28377,7 +28456,7 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: dsat [-CILDE num] [-pansvh]\n" );
+    Abc_Print( -2, "usage: dsat [-CILDEP num] [-pansvh]\n" );
     Abc_Print( -2, "\t         solves the combinational miter using SAT solver MiniSat-1.14\n" );
     Abc_Print( -2, "\t         derives CNF from the current network and leaves it unchanged\n" );
     Abc_Print( -2, "\t-C num : limit on the number of conflicts [default = %d]\n",    nConfLimit );
@@ -28385,6 +28464,7 @@ usage:
     Abc_Print( -2, "\t-L num : starting value for learned clause removal [default = %d]\n", nLearnedStart );
     Abc_Print( -2, "\t-D num : delta value for learned clause removal [default = %d]\n", nLearnedDelta );
     Abc_Print( -2, "\t-E num : ratio percentage for learned clause removal [default = %d]\n", nLearnedPerce );
+    Abc_Print( -2, "\t-P num : the number of threads used to derive CNF [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-p     : align polarity of SAT variables [default = %s]\n", fAlignPol? "yes": "no" );
     Abc_Print( -2, "\t-a     : toggle ANDing/ORing of miter outputs [default = %s]\n", fAndOuts? "ANDing": "ORing" );
     Abc_Print( -2, "\t-n     : toggle using new solver [default = %s]\n", fNewSolver? "yes": "no" );
@@ -29731,7 +29811,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Saig_ParBmcSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLWaxdursgvzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLWaxdursgcvzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -29906,6 +29986,9 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'g':
             pPars->fUseGlucose ^= 1;
             break;
+        case 'c':
+            pPars->fUseCadical ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -29977,7 +30060,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-LW file] [-axdursgvzh]\n" );
+    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-LW file] [-axdursgcvzh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking with dynamic unrolling\n" );
     Abc_Print( -2, "\t-S num : the starting time frame [default = %d]\n", pPars->nStart );
     Abc_Print( -2, "\t-F num : the max number of time frames (0 = unused) [default = %d]\n",      pPars->nFramesMax );
@@ -30000,6 +30083,7 @@ usage:
     Abc_Print( -2, "\t-r     : toggle disabling periodic restarts [default = %s]\n",              pPars->fNoRestarts? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle using Satoko by Bruno Schmitt [default = %s]\n", pPars->fUseSatoko? "yes": "no" );
     Abc_Print( -2, "\t-g     : toggle using Glucose 3.0 by Gilles Audemard and Laurent Simon [default = %s]\n",pPars->fUseGlucose? "yes": "no" );
+    Abc_Print( -2, "\t-c     : toggle using CaDiCaL by Armin Biere [default = %s]\n",             pPars->fUseCadical? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n",                           pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-z     : toggle suppressing report about solved outputs [default = %s]\n",  pPars->fNotVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -33086,11 +33170,23 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fSkipStrash = 0;
     int fNewReader = 0;
     int fDetectXors = 0;
+    int nProcs = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "csxmnlpvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pcsxmnlpvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 'c':
             fGiaSimple ^= 1;
             break;
@@ -33155,7 +33251,7 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
 //        Abc3_ReadShowHie( FileName, fSkipStrash );
     else
     {
-        pAig = Gia_AigerRead( FileName, fGiaSimple, fSkipStrash, 0 );
+        pAig = Gia_AigerReadPar( FileName, fGiaSimple, fSkipStrash, 0, nProcs );
         if ( fDetectXors )
         {
             Gia_Man_t * pTemp;
@@ -33168,8 +33264,9 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &r [-csxmnlvh] <file>\n" );
+    Abc_Print( -2, "usage: &r [-P num] [-csxmnlvh] <file>\n" );
     Abc_Print( -2, "\t         reads the current AIG from the AIGER file\n" );
+    Abc_Print( -2, "\t-P num : the number of threads decoding a file with the block index [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-c     : toggles reading simple AIG [default = %s]\n", fGiaSimple? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggles structural hashing while reading [default = %s]\n", !fSkipStrash? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggles detecting XORs while reading [default = %s]\n", fDetectXors? "yes": "no" );
@@ -34246,12 +34343,25 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fWriteNewLine = 0;
     int fReverse = 0;
     int fSkipComment = 0;
+    int fImage = 0;
     int fVerbose = 0;
+    int nProcs = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "upqicabmlnrsvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pupqicabmlnrsgvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 0 )
+                goto usage;
+            break;
         case 'u':
             fUnique ^= 1;
             break;
@@ -34288,6 +34398,9 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 's':
             fSkipComment ^= 1;
             break;
+        case 'g':
+            fImage ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -34324,13 +34437,16 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
         Gia_ManWriteMiniAig( pAbc->pGia, pFileName );
     else if ( fMiniLut )
         Gia_ManWriteMiniLut( pAbc->pGia, pFileName );
+    else if ( fImage )
+        Gia_ManImageWrite( pAbc->pGia, pFileName );
     else
-        Gia_AigerWriteS( pAbc->pGia, pFileName, 0, 0, fWriteNewLine, fSkipComment );
+        Gia_AigerWriteSPar( pAbc->pGia, pFileName, 0, 0, fWriteNewLine, fSkipComment, nProcs );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &w [-upqicabmlnsvh] <file>\n" );
+    Abc_Print( -2, "usage: &w [-P num] [-upqicabmlnsgvh] <file>\n" );
     Abc_Print( -2, "\t         writes the current AIG into the AIGER file\n" );
+    Abc_Print( -2, "\t-P num : the number of threads; if non-zero, writes the block index for parallel reading [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-u     : toggle writing canonical AIG structure [default = %s]\n", fUnique? "yes" : "no" );
     Abc_Print( -2, "\t-p     : toggle writing Verilog with 'and' and 'not' [default = %s]\n", fVerilog? "yes" : "no" );
     Abc_Print( -2, "\t-q     : toggle writing Verilog with NAND-gates [default = %s]\n", fVerNand? "yes" : "no" );
@@ -34343,6 +34459,7 @@ usage:
     Abc_Print( -2, "\t-n     : toggle writing \'\\n\' after \'c\' in the AIGER file [default = %s]\n", fWriteNewLine? "yes": "no" );
     //Abc_Print( -2, "\t-r     : toggle reversing the order of input/output bits [default = %s]\n", fReverse? "yes": "no" );    
     Abc_Print( -2, "\t-s     : toggle skipping the timestamp in the output file [default = %s]\n", fSkipComment? "yes": "no" );
+    Abc_Print( -2, "\t-g     : toggle writing the memory image read by &r without parsing (AIGER if the AIG has names, mapping, etc) [default = %s]\n", fImage? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t<file> : the file name\n");
@@ -35367,8 +35484,9 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fStrMuxes  = 0;
     int fRehashMap = 0;
     int fInvert    = 0;
+    int nThreads   = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "LMbacmrsih" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "LMPbacmrsih" ) ) != EOF )
     {
         switch ( c )
         {
@@ -35394,6 +35512,17 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( Multi <= 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads <= 0 )
+                goto usage;
+            break;
         case 'b':
             fAddBuffs ^= 1;
             break;
@@ -35498,6 +35627,8 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         if ( !Abc_FrameReadFlag("silentmode") )
             printf( "Generated AIG from AND/XOR/MUX graph.\n" );
     }
+    else if ( nThreads > 1 && !fAddStrash )
+        pTemp = Gia_ManRehashPar( pAbc->pGia, nThreads );
     else
     {
         pTemp = Gia_ManRehash( pAbc->pGia, fAddStrash );
@@ -35514,7 +35645,7 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &st [-LM num] [-bacmrsih]\n" );
+    Abc_Print( -2, "usage: &st [-LMP num] [-bacmrsih]\n" );
     Abc_Print( -2, "\t         performs structural hashing\n" );
     Abc_Print( -2, "\t-b     : toggle adding buffers at the inputs and outputs [default = %s]\n", fAddBuffs? "yes": "no" );
     Abc_Print( -2, "\t-a     : toggle additional hashing [default = %s]\n", fAddStrash? "yes": "no" );
@@ -35523,6 +35654,8 @@ usage:
     Abc_Print( -2, "\t-L num : create MUX when sum of refs does not exceed this limit [default = %d]\n", Limit );
     Abc_Print( -2, "\t         (use L = 1 to create AIG with XORs but without MUXes)\n" );
     Abc_Print( -2, "\t-M num : create an AIG with additional primary inputs [default = %d]\n", Multi );
+    Abc_Print( -2, "\t-P num : the number of threads for structural hashing [default = %d]\n", nThreads );
+    Abc_Print( -2, "\t         (with P > 1, the result is the same as with P = 1)\n" );
     Abc_Print( -2, "\t-r     : toggle rehashing AIG while preserving mapping [default = %s]\n", fRehashMap? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle using MUX restructuring [default = %s]\n", fStrMuxes? "yes": "no" );
     Abc_Print( -2, "\t-i     : toggle complementing the POs of the AIG [default = %s]\n", fInvert? "yes": "no" );
@@ -37165,6 +37298,80 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9LevSim( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    extern void Gia_ManSimPatSimLevelTest( Gia_Man_t * pGia, int nWords, int nProcs, int fVerbose );
+    int c, nWords = 64, nProcs = 4, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WPvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nWords = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nWords <= 0 )
+                goto usage;
+            break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9LevSim(): There is no AIG.\n" );
+        return 1;
+    }
+    if ( Gia_ManRegNum(pAbc->pGia) > 0 )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9LevSim(): This command works only for combinational AIGs.\n" );
+        return 0;
+    }
+    Gia_ManSimPatSimLevelTest( pAbc->pGia, nWords, nProcs, fVerbose );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &sim_lev [-WP num] [-vh]\n" );
+    Abc_Print( -2, "\t         compares level-partitioned multi-threaded simulation with serial simulation\n" );
+    Abc_Print( -2, "\t-W num : the number of 64-bit words of random patterns if none are given [default = %d]\n", nWords );
+    Abc_Print( -2, "\t-P num : the number of concurrent threads [default = %d]\n",                               nProcs );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",                            fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -40590,7 +40797,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fCbs = 1, approxLim = 600, subBatchSz = 1, adaRecycle = 500, nMaxNodes = 0;
     Cec4_ManSetParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPMFrmdckngxysopwqvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPMQFrmdckngxysopwqvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -40704,6 +40911,17 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nMaxNodes < 0 )
                 goto usage;
             break;
+        case 'Q':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Q\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 0 )
+                goto usage;
+            break;
         case 'F':
             if ( globalUtilOptind >= argc )
             {
@@ -40794,7 +41012,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &fraig [-JWRILDCNPM <num>] [-F filename] [-rmdckngxysopwvh]\n" );
+    Abc_Print( -2, "usage: &fraig [-JWRILDCNPMQ <num>] [-F filename] [-rmdckngxysopwvh]\n" );
     Abc_Print( -2, "\t         performs combinational SAT sweeping\n" );
     Abc_Print( -2, "\t-J num : the solver type [default = %d]\n", pPars->jType );
     Abc_Print( -2, "\t-W num : the number of simulation words [default = %d]\n", pPars->nWords );
@@ -40806,6 +41024,7 @@ usage:
     Abc_Print( -2, "\t-N num : the min number of calls to recycle the solver [default = %d]\n", pPars->nCallsRecycle );
     Abc_Print( -2, "\t-P num : the number of pattern generation iterations [default = %d]\n", pPars->nGenIters );
     Abc_Print( -2, "\t-M num : the node count limit to call the old sweeper [default = %d]\n", nMaxNodes );
+    Abc_Print( -2, "\t-Q num : the number of concurrent threads used by -x [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-F file: the file name to dump primary output information [default = none]\n" );
     Abc_Print( -2, "\t-r     : toggle the use of AIG rewriting [default = %s]\n", pPars->fRewriting? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
@@ -41395,12 +41614,13 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Cec_ParCec_t ParsCec, * pPars = &ParsCec;
     FILE * pFile;
-    Gia_Man_t * pGias[2] = {NULL, NULL}, * pMiter;
-    char ** pArgvNew;
+    Gia_Man_t * pGias[2] = {NULL, NULL}, * pMiter, * pSpecInit = NULL;
+    Vec_Wrd_t * vSimsCache = NULL;
+    char ** pArgvNew, * pCacheName = NULL;
     int c, nArgcNew, fUseSim = 0, fUseNewX = 0, fUseNewY = 0, fMiter = 0, fDualOutput = 0, fDumpMiter = 0;
     Cec_ManCecSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CTnmdasxytvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CTPSFnmdasxytvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -41426,6 +41646,37 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 0 )
+                goto usage;
+            break;
+        case 'S':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-S\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->SolverType = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->SolverType < 0 || pPars->SolverType >= SAT_BACKEND_NUM )
+                goto usage;
+            break;
+        case 'F':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-F\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pCacheName = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'n':
             pPars->fNaive ^= 1;
             break;
@@ -41462,6 +41713,8 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             goto usage;
         }
     }
+    if ( pPars->nProcs > 1 || pCacheName )
+        fUseNewX = 1;
     if ( pAbc->pGia && pAbc->pGia->nXors )
     {
         Abc_Print( 0, "It looks like the current AIG is derived by &st -m.  Such AIG contains XOR gates and cannot be verified before &st is applied.\n" );
@@ -41606,6 +41859,14 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             return 0;
         }
     }
+    // reduce the specification using the cached equivalences
+    if ( pCacheName )
+    {
+        extern Gia_Man_t * Cec4_ManCacheLoad( Gia_Man_t * pSpec, char * pFileName, Vec_Wrd_t ** pvSimsPi, int fVerbose );
+        Gia_Man_t * pTemp = Cec4_ManCacheLoad( pGias[1], pCacheName, &vSimsCache, pPars->fVerbose );
+        if ( pTemp )
+            pSpecInit = pGias[1], pGias[1] = pTemp;
+    }
     // compute the miter
     if ( Gia_ManCiNum(pGias[0]) < 6 )
     {
@@ -41635,6 +41896,16 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             pMiter->vSimsPi = Vec_WrdDup(pGias[0]->vSimsPi); 
             pMiter->nSimWords = pGias[0]->nSimWords;
         }
+        else if ( vSimsCache && Gia_ManCiNum(pMiter) == Gia_ManCiNum(pGias[1]) )
+        {
+            pMiter->vSimsPi = Vec_WrdDup(vSimsCache); 
+            pMiter->nSimWords = Vec_WrdSize(vSimsCache) / Gia_ManCiNum(pMiter);
+        }
+        if ( pCacheName ) // record the patterns and the equivalences to be cached
+        {
+            pMiter->vPats   = Vec_IntAlloc( 1000 );
+            pMiter->vProved = Vec_IntAlloc( 1000 );
+        }
         if ( fUseSim && Gia_ManCiNum(pMiter) > 40 )
         {
             Abc_Print( -1, "This type of CEC can only be applied to AIGs with no more than 40 inputs.\n" );
@@ -41656,14 +41927,25 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
         else if ( fUseNewX )
         {
             abctime clk = Abc_Clock();
-            extern Gia_Man_t * Cec4_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose );
-            Gia_Man_t * pNew = Cec4_ManSimulateTest3( pMiter, pPars->nBTLimit, pPars->fVerbose );
-            if ( Gia_ManAndNum(pNew) == 0 )
+            extern Gia_Man_t * Cec4_ManSimulateTestPar( Gia_Man_t * p, int nBTLimit, int nProcs, int fVerbose );
+            Gia_Man_t * pNew = Cec4_ManSimulateTestPar( pMiter, pPars->nBTLimit, pPars->nProcs, pPars->fVerbose );
+            int k, nFails = 0;
+            // the outputs of the miter are proved if they are reduced to constant 0
+            for ( k = 0; k < Gia_ManPoNum(pNew); k++ )
+                nFails += !Gia_ManPoIsConst0( pNew, k );
+            if ( nFails == 0 )
                 Abc_Print( 1, "Networks are equivalent.  " );
+            else if ( Gia_ManAndNum(pNew) == 0 )
+                Abc_Print( 1, "Networks are NOT EQUIVALENT.  " );
             else
                 Abc_Print( 1, "Networks are UNDECIDED.  " );
             Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
             Gia_ManStop( pNew );
+            if ( pCacheName )
+            {
+                extern void Cec4_ManCacheSave( Gia_Man_t * pSpec, Gia_Man_t * pMiter, Vec_Wrd_t * vSimsOld, char * pFileName, int fVerbose );
+                Cec4_ManCacheSave( pSpecInit ? pSpecInit : pGias[1], pMiter, vSimsCache, pCacheName, pPars->fVerbose );
+            }
         }
         else if ( fUseNewY )
         {
@@ -41687,13 +41969,19 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     if ( pGias[0] != pAbc->pGia )
         Gia_ManStop( pGias[0] );
     Gia_ManStop( pGias[1] );
+    if ( pSpecInit )
+        Gia_ManStop( pSpecInit );
+    Vec_WrdFreeP( &vSimsCache );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &cec [-CT num] [-nmdasxytvwh]\n" );
+    Abc_Print( -2, "usage: &cec [-CTPS num] [-F file] [-nmdasxytvwh]\n" );
     Abc_Print( -2, "\t         new combinational equivalence checker\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of threads for SAT sweeping (implies -x) [default = %d]\n", pPars->nProcs );
+    Abc_Print( -2, "\t-S num : the SAT solver for naive checking (0=bsat, 1=satoko, 2=glucose, 3=cadical) [default = %d]\n", pPars->SolverType );
+    Abc_Print( -2, "\t-F file: the cache of equivalences and patterns of the second circuit (implies -x) [default = %s]\n", pCacheName ? pCacheName : "none" );
     Abc_Print( -2, "\t-n     : toggle using naive SAT-based checking [default = %s]\n", pPars->fNaive? "yes":"no");
     Abc_Print( -2, "\t-m     : toggle miter vs. two circuits [default = %s]\n", fMiter? "miter":"two circuits");
     Abc_Print( -2, "\t-d     : toggle using dual output miter [default = %s]\n", fDualOutput? "yes":"no");
@@ -49678,10 +49966,10 @@ usage:
 ***********************************************************************/
 int Abc_CommandAbc9SplitProve( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    extern int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent );
-    int c, nProcs = 1, nTimeOut = 10, nIterMax = 0, LookAhead = 1, fVerbose = 0, fVeryVerbose = 0, fSilent = 0;
+    extern int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nConfLimit, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent );
+    int c, nProcs = 1, nConfLimit = 0, nTimeOut = 10, nIterMax = 0, LookAhead = 1, fVerbose = 0, fVeryVerbose = 0, fSilent = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "PTILsvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PCTILsvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -49696,6 +49984,17 @@ int Abc_CommandAbc9SplitProve( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nProcs <= 0 )
                 goto usage;
             break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nConfLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nConfLimit < 0 )
+                goto usage;
+            break;
         case 'T':
             if ( globalUtilOptind >= argc )
             {
@@ -49757,14 +50056,15 @@ int Abc_CommandAbc9SplitProve( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9SplitProve(): The problem is sequential.\n" );
         return 1;
     }
-    pAbc->Status = Cec_GiaSplitTest( pAbc->pGia, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
+    pAbc->Status = Cec_GiaSplitTest( pAbc->pGia, nProcs, nConfLimit, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
     pAbc->pCex = pAbc->pGia->pCexComb;  pAbc->pGia->pCexComb = NULL;
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &splitprove [-PTIL num] [-svwh]\n" );
+    Abc_Print( -2, "usage: &splitprove [-PCTIL num] [-svwh]\n" );
     Abc_Print( -2, "\t         proves CEC problem by case-splitting\n" );
     Abc_Print( -2, "\t-P num : the number of concurrent processes [default = %d]\n",          nProcs );
+    Abc_Print( -2, "\t-C num : conflict limit per cube (0 = cofactoring without cubes) [default = %d]\n", nConfLimit );
     Abc_Print( -2, "\t-T num : runtime limit in seconds per subproblem [default = %d]\n",     nTimeOut );
     Abc_Print( -2, "\t-I num : the max number of iterations (0 = infinity) [default = %d]\n", nIterMax );
     Abc_Print( -2, "\t-L num : maximum look-ahead during cofactoring [default = %d]\n",       LookAhead );
@@ -49788,10 +50088,10 @@ usage:
 ***********************************************************************/
 int Abc_CommandAbc9SProve( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    extern int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3, int fVerbose, int fVeryVerbose, int fSilent );
-    int c, nProcs = 5, nTimeOut = 3, nTimeOut2 = 10, nTimeOut3 = 100, fVerbose = 0, fVeryVerbose = 0, fSilent = 0;
+    extern int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3, int fShare, int fVerbose, int fVeryVerbose, int fSilent );
+    int c, nProcs = 5, nTimeOut = 3, nTimeOut2 = 10, nTimeOut3 = 100, fShare = 0, fVerbose = 0, fVeryVerbose = 0, fSilent = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "PTUWsvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PTUWasvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -49839,6 +50139,9 @@ int Abc_CommandAbc9SProve( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nTimeOut3 <= 0 )
                 goto usage;
             break;                          
+        case 'a':
+            fShare ^= 1;
+            break;
         case 's':
             fSilent ^= 1;
             break;
@@ -49864,17 +50167,18 @@ int Abc_CommandAbc9SProve( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9SProve(): The problem is combinational.\n" );
         return 1;
     }
-    pAbc->Status = Cec_GiaProveTest( pAbc->pGia, nProcs, nTimeOut, nTimeOut2, nTimeOut3, fVerbose, fVeryVerbose, fSilent );
+    pAbc->Status = Cec_GiaProveTest( pAbc->pGia, nProcs, nTimeOut, nTimeOut2, nTimeOut3, fShare, fVerbose, fVeryVerbose, fSilent );
     Abc_FrameReplaceCex( pAbc, &pAbc->pGia->pCexSeq ); 
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sprove [-PTUW num] [-svwh]\n" );
+    Abc_Print( -2, "usage: &sprove [-PTUW num] [-asvwh]\n" );
     Abc_Print( -2, "\t         proves CEC problem by case-splitting\n" );
     Abc_Print( -2, "\t-P num : the number of concurrent processes [default = %d]\n",          nProcs );
     Abc_Print( -2, "\t-T num : runtime limit in seconds per subproblem [default = %d]\n",     nTimeOut );
     Abc_Print( -2, "\t-U num : runtime limit in seconds per subproblem [default = %d]\n",     nTimeOut2 );
     Abc_Print( -2, "\t-W num : runtime limit in seconds per subproblem [default = %d]\n",     nTimeOut3 );    
+    Abc_Print( -2, "\t-a     : toggle sharing partial results among the engines [default = %s]\n", fShare? "yes": "no" );
     Abc_Print( -2, "\t-s     : enable silent computation (no reporting) [default = %s]\n",    fSilent? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",         fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printing more verbose information [default = %s]\n",    fVeryVerbose? "yes": "no" );
@@ -50210,6 +50514,7 @@ int Abc_CommandAbc9SBmc( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->fUseOldCnf    =    0;  // use old CNF construction
     pPars->fUseGlucose   =    0;  // use Glucose 3.0
     pPars->fUseEliminate =    0;  // use variable elimination
+    pPars->fSplitOuts    =    0;  // parallel solvers work on different outputs
     pPars->fVerbose      =    0;  // verbose
     pPars->fVeryVerbose  =    0;  // very verbose
     pPars->fNotVerbose   =    0;  // skip line-by-line print-out
@@ -50219,7 +50524,7 @@ int Abc_CommandAbc9SBmc( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->pFuncOnFrameDone = pAbc->pFuncOnFrameDone; // frame done callback
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "PCFATgevwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PCFATgesvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -50284,6 +50589,9 @@ int Abc_CommandAbc9SBmc( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'e':
             pPars->fUseEliminate ^= 1;
             break;
+        case 's':
+            pPars->fSplitOuts ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -50312,7 +50620,7 @@ int Abc_CommandAbc9SBmc( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &bmcs [-PCFAT num] [-gevwh]\n" );
+    Abc_Print( -2, "usage: &bmcs [-PCFAT num] [-gesvwh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking\n" );
     Abc_Print( -2, "\t-P num : the number of parallel solvers [default = %d]\n",              pPars->nProcs );
     Abc_Print( -2, "\t-C num : the SAT solver conflict limit [default = %d]\n",               pPars->nConfLimit );
@@ -50321,6 +50629,7 @@ usage:
     Abc_Print( -2, "\t-T num : approximate timeout in seconds [default = %d]\n",              pPars->nTimeOut );
     Abc_Print( -2, "\t-g     : toggle using Glucose 3.0 by Gilles Audemard and Laurent Simon [default = %s]\n", pPars->fUseGlucose?  "Glucose" : "Satoko" );
     Abc_Print( -2, "\t-e     : toggle using variable eliminatation [default = %s]\n",         pPars->fUseEliminate?"yes": "no" );
+    Abc_Print( -2, "\t-s     : toggle solving different outputs by the parallel solvers [default = %s]\n", pPars->fSplitOuts?"yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",         pPars->fVerbose?     "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printing information about unfolding [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -1913,7 +1913,7 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int nThreads, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
@@ -1921,6 +1921,7 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     Cnf_Dat_t * pCnf;
     Abc_Ntk_t * pNtkNew = NULL;
     abctime clk = Abc_Clock();
+    int fStream;
     assert( Abc_NtkIsStrash(pNtk) );
 
     // convert to the AIG manager
@@ -1937,14 +1938,24 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     if ( fVerbose )
     Aig_ManPrintStats( pMan );
 
-    // derive CNF
-    if ( fFastAlgo )
+    // derive CNF (unless compressed, write it into the file as it is derived)
+    Cnf_ManSetThreadNum( nThreads );
+    fStream = !fFastAlgo && (strlen(pFileName) < 3 || strncmp(pFileName+strlen(pFileName)-3, ".gz", 3));
+    if ( fStream )
+        pCnf = Cnf_DeriveIntoFile( pMan, 0, fChangePol, pFileName );
+    else if ( fFastAlgo )
         pCnf = Cnf_DeriveFast( pMan, 0 );
     else
         pCnf = Cnf_Derive( pMan, 0 );
+    if ( pCnf == NULL )
+    {
+        Cnf_ManFree();
+        Aig_ManStop( pMan );
+        return NULL;
+    }
 
     // adjust polarity
-    if ( fChangePol )
+    if ( fChangePol && !fStream )
         Cnf_DataTranformPolarity( pCnf, 0 );
 
     // print stats
@@ -1962,7 +1973,8 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     Vec_PtrFree( vMapped );
 */
     // write CNF into a file
-    Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
+    if ( !fStream )
+        Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
     Cnf_DataFree( pCnf );
     Cnf_ManFree();
     Aig_ManStop( pMan );
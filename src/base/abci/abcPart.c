@@ -1288,10 +1288,11 @@ typedef struct StochSynData_t_
     Abc_Ntk_t *  pOut;
     char *       pScript;
     int          Rand;
-    int          TimeOut;
+    int          fThreads;
 } StochSynData_t;
 
-Abc_Ntk_t * Abc_NtkStochProcessOne( Abc_Ntk_t * p, char * pScript0, int Rand, int TimeSecs )
+// runs the script in a separate ABC process (used if it is not thread-safe)
+Abc_Ntk_t * Abc_NtkStochProcessOneProc( Abc_Ntk_t * p, char * pScript0, int Rand )
 {
     extern int Abc_NtkWriteToFile( char * pFileName, Abc_Ntk_t * pNtk );
     extern Abc_Ntk_t * Abc_NtkReadFromFile( char * pFileName );
@@ -1328,13 +1329,35 @@ Abc_Ntk_t * Abc_NtkStochProcessOne( Abc_Ntk_t * p, char * pScript0, int Rand, in
     if ( pNew ) Abc_NtkDelete( pNew );
     return Abc_NtkDupDfs(p);
 }
+// runs the script in a private frame of the calling thread
+Abc_Ntk_t * Abc_NtkStochProcessOne( Abc_Ntk_t * p, char * pScript0, int Rand, int fThreads )
+{
+    Abc_Ntk_t * pNew = NULL, * pTemp;
+    if ( !fThreads )
+        return Abc_NtkStochProcessOneProc( p, pScript0, Rand );
+    Abc_Frame_t * pAbc = Abc_FrameStartLocal();
+    void * pLibGen = Abc_FrameReadLibGen();
+    char * pScript = Abc_UtilStrsav( pScript0 );
+    // the mapped network is processed with its own library
+    if ( Abc_NtkIsMappedLogic(p) )
+        Abc_FrameSetLibGen( p->pManFunc );
+    Abc_FrameReplaceCurrentNetwork( pAbc, Abc_NtkDupDfs(p) );
+    if ( Cmd_CommandExecute( pAbc, pScript ) )
+        Abc_Print( 1, "Something did not work out with the command \"%s\".\n", pScript );
+    else if ( (pTemp = Abc_FrameReadNtk(pAbc)) && Abc_NtkGetMappedArea(pTemp) <= Abc_NtkGetMappedArea(p) )
+        pNew = Abc_NtkDupDfs( pTemp );
+    Abc_FrameSetLibGen( pLibGen );
+    Abc_FrameStopLocal( pAbc );
+    ABC_FREE( pScript );
+    return pNew ? pNew : Abc_NtkDupDfs(p);
+}
 
 int Abc_NtkStochProcess1( void * p )
 {
     StochSynData_t * pData = (StochSynData_t *)p;
     assert( pData->pIn != NULL );
     assert( pData->pOut == NULL );
-    pData->pOut = Abc_NtkStochProcessOne( pData->pIn, pData->pScript, pData->Rand, pData->TimeOut );
+    pData->pOut = Abc_NtkStochProcessOne( pData->pIn, pData->pScript, pData->Rand, pData->fThreads );
     return 1;
 }
 
@@ -1347,16 +1370,18 @@ Vec_Int_t * Abc_NtkStochProcess( Vec_Ptr_t * vWins, char * pScript, int nProcs,
     StochSynData_t * pData = ABC_CALLOC( StochSynData_t, Vec_PtrSize(vWins) );
     Vec_Ptr_t * vData = Vec_PtrAlloc( Vec_PtrSize(vWins) ); 
     Abc_Ntk_t * pNtk; int i;
+    // the scripts that are not thread-safe are run by separate processes
+    int fThreads = Cmd_CommandIsThreadSafe( Abc_FrameGetGlobalFrame(), pScript );
     //Abc_Random(1);
     Vec_PtrForEachEntry( Abc_Ntk_t *, vWins, pNtk, i ) {
         pData[i].pIn     = pNtk;
         pData[i].pOut    = NULL;
         pData[i].pScript = pScript;
         pData[i].Rand    = Abc_Random(0) % 0x1000000;
-        pData[i].TimeOut = TimeSecs;
+        pData[i].fThreads = fThreads;
         Vec_PtrPush( vData, pData+i );
     }
-    Util_ProcessThreads( Abc_NtkStochProcess1, vData, nProcs, TimeSecs, fVerbose );
+    Util_ProcessThreads( Abc_NtkStochProcess1, vData, nProcs, fVerbose );
     // replace old AIGs by new AIGs
     Vec_PtrForEachEntry( Abc_Ntk_t *, vWins, pNtk, i ) {
         if ( Abc_NtkIsMappedLogic(pNtk) )
@@ -1923,7 +1948,7 @@ void Abc_NtkStochMap( int nSuppMax, int nIters, int TimeOut, int Seed, int fOver
     if ( fVerbose ) {
         printf( "Running %d iterations of the script \"%s\"", nIters, pScript );
         if ( nProcs > 2 )
-            printf( " using %d concurrent threads.\n", nProcs-1 );
+            printf( " using %d concurrent %s.\n", nProcs-1, Cmd_CommandIsThreadSafe(Abc_FrameGetGlobalFrame(), pScript) ? "threads" : "processes" );
         else
             printf( " without concurrency.\n" );
         fflush(stdout);
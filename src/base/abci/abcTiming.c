@@ -703,6 +703,51 @@ void Abc_ManTimeExpand( Abc_ManTime_t * p, int nSize, int fProgressive )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Moves the timing information after renumbering the objects.]
+
+  Description [pMap maps the old object IDs into the new ones (or -1).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkTimeRemapIds( Abc_Ntk_t * pNtk, int * pMap, int nObjsOld, int nObjsNew )
+{
+    Abc_ManTime_t * p = pNtk->pManTime;
+    Abc_Time_t * pArrsOld, * pReqsOld, * pArrs, * pReqs;
+    int i, nSizeOld = Vec_PtrSize(p->vArrs);
+    int nSizeNew = Abc_MaxInt( nSizeOld, nObjsNew );
+    if ( nSizeOld == 0 )
+        return;
+    pArrsOld = (Abc_Time_t *)p->vArrs->pArray[0];
+    pReqsOld = (Abc_Time_t *)p->vReqs->pArray[0];
+    pArrs = ABC_ALLOC( Abc_Time_t, nSizeNew );
+    pReqs = ABC_ALLOC( Abc_Time_t, nSizeNew );
+    for ( i = 0; i < nSizeNew; i++ )
+    {
+        pArrs[i].Rise = pArrs[i].Fall = -ABC_INFINITY;
+        pReqs[i].Rise = pReqs[i].Fall =  ABC_INFINITY;
+    }
+    for ( i = 0; i < Abc_MinInt(nSizeOld, nObjsOld); i++ )
+        if ( pMap[i] >= 0 )
+        {
+            pArrs[pMap[i]] = pArrsOld[i];
+            pReqs[pMap[i]] = pReqsOld[i];
+        }
+    ABC_FREE( pArrsOld );
+    ABC_FREE( pReqsOld );
+    Vec_PtrFill( p->vArrs, nSizeNew, NULL );
+    Vec_PtrFill( p->vReqs, nSizeNew, NULL );
+    for ( i = 0; i < nSizeNew; i++ )
+    {
+        p->vArrs->pArray[i] = pArrs + i;
+        p->vReqs->pArray[i] = pReqs + i;
+    }
+}
+
 
 
 
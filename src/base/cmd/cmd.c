@@ -88,7 +88,8 @@ void Cmd_Init( Abc_Frame_t * pAbc )
     pAbc->tAliases  = st__init_table(strcmp, st__strhash);
     pAbc->tFlags    = st__init_table(strcmp, st__strhash);
     pAbc->aHistory  = Vec_PtrAlloc( 100 );
-    Cmd_HistoryRead( pAbc );
+    if ( !pAbc->fThreadLocal )
+        Cmd_HistoryRead( pAbc );
 
     Cmd_CommandAdd( pAbc, "Basic", "time",          CmdCommandTime,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "sleep",         CmdCommandSleep,           0 );
@@ -140,7 +141,8 @@ void Cmd_End( Abc_Frame_t * pAbc )
 {
     st__generator * gen;
     char * pKey, * pValue;
-    Cmd_HistoryWrite( pAbc, ABC_INFINITY );
+    if ( !pAbc->fThreadLocal )
+        Cmd_HistoryWrite( pAbc, ABC_INFINITY );
 
 //    st__free_table( pAbc->tCommands, (void (*)()) 0, CmdCommandFree );
 //    st__free_table( pAbc->tAliases,  (void (*)()) 0, CmdCommandAliasFree );
@@ -161,6 +163,29 @@ void Cmd_End( Abc_Frame_t * pAbc )
     Vec_PtrFreeFree( pAbc->aHistory );
 }
 
+/**Function********************************************************************
+
+  Synopsis    [Copies the aliases and the flags from another frame.]
+
+  Description [The entries already defined in the frame are not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+void Cmd_CopySettings( Abc_Frame_t * pAbc, Abc_Frame_t * pFrom )
+{
+    st__generator * gen;
+    char * pKey, * pValue;
+    st__foreach_item( pFrom->tAliases, gen, (const char **)&pKey, (char **)&pValue )
+        if ( !st__is_member( pAbc->tAliases, pKey ) )
+            CmdCommandAliasAdd( pAbc, pKey, ((Abc_Alias *)pValue)->argc, ((Abc_Alias *)pValue)->argv );
+    st__foreach_item( pFrom->tFlags, gen, (const char **)&pKey, (char **)&pValue )
+        if ( !st__is_member( pAbc->tFlags, pKey ) )
+            st__insert( pAbc->tFlags, Extra_UtilStrsav(pKey), Extra_UtilStrsav(pValue) );
+}
+
 
 
 /**Function********************************************************************
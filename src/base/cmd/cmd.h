@@ -50,9 +50,11 @@ typedef struct MvAlias      Abc_Alias;    // one alias
 /*=== cmd.c ===========================================================*/
 extern void        Cmd_Init( Abc_Frame_t * pAbc );
 extern void        Cmd_End( Abc_Frame_t * pAbc );
+extern void        Cmd_CopySettings( Abc_Frame_t * pAbc, Abc_Frame_t * pFrom );
 /*=== cmdApi.c ========================================================*/
 typedef int (*Cmd_CommandFuncType)(Abc_Frame_t*, int, char**);
 extern int         Cmd_CommandIsDefined( Abc_Frame_t * pAbc, const char * sName );
+extern int         Cmd_CommandIsThreadSafe( Abc_Frame_t * pAbc, const char * sScript );
 extern void        Cmd_CommandAdd( Abc_Frame_t * pAbc, const char * sGroup, const char * sName, Cmd_CommandFuncType pFunc, int fChanges );
 extern ABC_DLL int Cmd_CommandExecute( Abc_Frame_t * pAbc, const char * sCommand );
 /*=== cmdFlag.c ========================================================*/
@@ -49,6 +49,58 @@ int Cmd_CommandIsDefined( Abc_Frame_t * pAbc, const char * sName )
     return st__is_member( pAbc->tCommands, sName );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the script can be executed by several threads.]
+
+  Description [Most commands keep some state in static variables or in 
+  the process-wide managers, so they cannot be executed concurrently in
+  the private frames of the threads (Abc_FrameStartLocal). The script is 
+  accepted only if each of its commands is in the list below, for which 
+  the static state has been made thread-local. Aliases are rejected because
+  they may expand into other commands. Other scripts are run concurrently
+  by separate processes (see &stochsyn and stochmap).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static const char * s_CmdThreadSafe[] = {
+    "&st", "&dc2", "&syn2", "&syn3", "&syn4", "&b", "&dch", "&lf", 
+    "strash", "balance", "dc2", "dch", NULL
+};
+int Cmd_CommandIsThreadSafe( Abc_Frame_t * pAbc, const char * sScript )
+{
+    char * pScript = Extra_UtilStrsav( sScript ), * pCur = pScript, * pName, Sep;
+    int i, fSafe = 1;
+    while ( fSafe && *pCur )
+    {
+        // skip the separators and find the command name
+        while ( *pCur == ';' || *pCur == ' ' || *pCur == '\t' || *pCur == '\n' || *pCur == '\r' )
+            pCur++;
+        if ( *pCur == 0 )
+            break;
+        for ( pName = pCur; *pCur && *pCur != ';' && *pCur != ' ' && *pCur != '\t' && *pCur != '\n' && *pCur != '\r'; pCur++ );
+        if ( (Sep = *pCur) )
+            *pCur++ = 0;
+        if ( st__is_member( pAbc->tAliases, pName ) )
+            fSafe = 0;
+        else
+        {
+            for ( i = 0; s_CmdThreadSafe[i]; i++ )
+                if ( !strcmp( pName, s_CmdThreadSafe[i] ) )
+                    break;
+            fSafe = s_CmdThreadSafe[i] != NULL;
+        }
+        // skip the arguments of the command
+        while ( Sep != ';' && *pCur && *pCur != ';' )
+            pCur++;
+    }
+    ABC_FREE( pScript );
+    return fSafe;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -27,17 +27,6 @@
 #include "aig/gia/gia.h"
 #include "sat/satoko/satoko.h"
 
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
-#endif
-
-#endif
-
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -107,111 +96,43 @@ int Cmd_RunAutoTunerEvalSimple( Vec_Ptr_t * vAigs, satoko_opts_t * pOpts )
   SeeAlso     []
 
 ***********************************************************************/
-#ifndef ABC_USE_PTHREADS
-
-int Cmd_RunAutoTunerEval( Vec_Ptr_t * vAigs, satoko_opts_t * pOpts, int nCores )
-{
-    return Cmd_RunAutoTunerEvalSimple( vAigs, pOpts );
-}
-
-#else // pthreads are used
-
-
-#define CMD_THR_MAX 100
 typedef struct Cmd_AutoData_t_
 {
     Gia_Man_t *     pGia;
     satoko_opts_t * pOpts;
-    int             iThread;
-    int             nTimeOut;
-    int             fWorking;
-    int             Result;
 } Cmd_AutoData_t;
 
-void * Cmd_RunAutoTunerEvalWorkerThread( void * pArg )
+int Cmd_RunAutoTunerEvalOne( void * pArg )
 {
-    Cmd_AutoData_t * pThData = (Cmd_AutoData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->pGia == NULL ) // kills itself when there is nothing to do
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        pThData->Result = Gia_ManSatokoCallOne( pThData->pGia, pThData->pOpts, -1 );
-        pThData->fWorking = 0;
-    }
-    assert( 0 );
-    return NULL;
+    Cmd_AutoData_t * pData = (Cmd_AutoData_t *)pArg;
+    return Gia_ManSatokoCallOne( pData->pGia, pData->pOpts, -1 );
 }
 int Cmd_RunAutoTunerEval( Vec_Ptr_t * vAigs, satoko_opts_t * pOpts, int nProcs )
 {
-    Cmd_AutoData_t ThData[CMD_THR_MAX];
-    pthread_t WorkerThread[CMD_THR_MAX];
-    int i, status, fWorkToDo = 1, TotalCost = 0;
-    Vec_Ptr_t * vStack;
+    Cmd_AutoData_t * pData;
+    Util_Task_t ** pTasks;
+    Util_Sched_t * pSched;
+    Gia_Man_t * pGia;
+    int i, TotalCost = 0;
     if ( nProcs == 1 )
         return Cmd_RunAutoTunerEvalSimple( vAigs, pOpts );
-    // subtract manager thread
-    nProcs--;
-    assert( nProcs >= 1 && nProcs <= CMD_THR_MAX );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].pGia     = NULL;
-        ThData[i].pOpts    = pOpts;
-        ThData[i].iThread  = i;
-        ThData[i].nTimeOut = -1;
-        ThData[i].fWorking = 0;
-        ThData[i].Result   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cmd_RunAutoTunerEvalWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
-    }
-    // look at the threads
-    vStack = Vec_PtrDup(vAigs);
-    while ( fWorkToDo )
-    {
-        fWorkToDo = (int)(Vec_PtrSize(vStack) > 0);
-        for ( i = 0; i < nProcs; i++ )
-        {
-            // check if this thread is working
-            if ( ThData[i].fWorking )
-            {
-                fWorkToDo = 1;
-                continue;
-            }
-            // check if this thread has recently finished
-            if ( ThData[i].pGia != NULL )
-            {
-                assert( ThData[i].Result >= 0 );
-                TotalCost += ThData[i].Result;
-                ThData[i].pGia = NULL;
-            }
-            if ( Vec_PtrSize(vStack) == 0 )
-                continue;
-            // give this thread a new job
-            assert( ThData[i].pGia == NULL );
-            ThData[i].pGia = (Gia_Man_t *)Vec_PtrPop( vStack );
-            ThData[i].fWorking = 1;
-        }
-    }
-    Vec_PtrFree( vStack );
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
+    pData  = ABC_CALLOC( Cmd_AutoData_t, Vec_PtrSize(vAigs) );
+    pTasks = ABC_CALLOC( Util_Task_t *, Vec_PtrSize(vAigs) );
+    pSched = Util_SchedStart( nProcs );
+    Vec_PtrForEachEntry( Gia_Man_t *, vAigs, pGia, i )
     {
-        assert( !ThData[i].fWorking );
-        // stop
-        ThData[i].pGia = NULL;
-        ThData[i].fWorking = 1;
+        pData[i].pGia  = pGia;
+        pData[i].pOpts = pOpts;
+        pTasks[i] = Util_SchedSubmit( pSched, Cmd_RunAutoTunerEvalOne, (void *)(pData + i) );
     }
+    for ( i = 0; i < Vec_PtrSize(vAigs); i++ )
+        TotalCost += Util_SchedWait( pSched, pTasks[i] );
+    Util_SchedStop( pSched );
+    ABC_FREE( pTasks );
+    ABC_FREE( pData );
     return TotalCost;
 }
 
-#endif // pthreads are used
-
 
 /**Function*************************************************************
 
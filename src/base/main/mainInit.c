@@ -114,7 +114,8 @@ void Abc_FrameInit( Abc_Frame_t * pAbc )
     Map_Init( pAbc );
     Mio_Init( pAbc );
     Super_Init( pAbc );
-    Libs_Init( pAbc );
+    if ( !pAbc->fThreadLocal )
+        Libs_Init( pAbc );
     Load_Init( pAbc );
     Scl_Init( pAbc );
     Wlc_Init( pAbc );
@@ -155,7 +156,8 @@ void Abc_FrameEnd( Abc_Frame_t * pAbc )
     Map_End( pAbc );
     Mio_End( pAbc );
     Super_End( pAbc );
-    Libs_End( pAbc );
+    if ( !pAbc->fThreadLocal )
+        Libs_End( pAbc );
     Load_End( pAbc );
     Scl_End( pAbc );
     Wlc_End( pAbc );
@@ -167,6 +169,58 @@ void Abc_FrameEnd( Abc_Frame_t * pAbc )
     Glucose_End( pAbc );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the private frame of the calling thread.]
+
+  Description [The frame has the same commands as the global frame but 
+  its own networks and AIGs, so that several threads can execute scripts
+  at the same time. The aliases and the flags are copied and the libraries 
+  are shared with the global frame. The plug-ins are not loaded. The frame
+  is current in the calling thread until Abc_FrameStopLocal() is called.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Frame_t * Abc_FrameStartLocal()
+{
+    Abc_Frame_t * pGlobal = Abc_FrameGetGlobalFrame();
+    Abc_Frame_t * pAbc = Abc_FrameAllocate();
+    assert( !pGlobal->fThreadLocal );
+    pAbc->fThreadLocal = 1;
+    pAbc->fBatchMode   = 1;
+    Abc_FrameSetLocalFrame( pAbc );
+    Abc_FrameInit( pAbc );
+    Cmd_CopySettings( pAbc, pGlobal );
+    If_LibLutFree( (If_LibLut_t *)pAbc->pLibLut );
+    pAbc->pLibLut   = pGlobal->pLibLut;
+    pAbc->pLibBox   = pGlobal->pLibBox;
+    pAbc->pLibGen   = pGlobal->pLibGen;
+    pAbc->pLibGen2  = pGlobal->pLibGen2;
+    pAbc->pLibSuper = pGlobal->pLibSuper;
+    pAbc->pLibScl   = pGlobal->pLibScl;
+    return pAbc;
+}
+void Abc_FrameStopLocal( Abc_Frame_t * pAbc )
+{
+    Abc_Frame_t * pGlobal;
+    assert( pAbc->fThreadLocal && pAbc == Abc_FrameReadGlobalFrame() );
+    Abc_FrameSetLocalFrame( NULL );
+    pGlobal = Abc_FrameReadGlobalFrame();
+    Abc_FrameSetLocalFrame( pAbc );
+    // the shared libraries belong to the global frame
+    if ( pAbc->pLibLut   == pGlobal->pLibLut   ) pAbc->pLibLut   = NULL;
+    if ( pAbc->pLibBox   == pGlobal->pLibBox   ) pAbc->pLibBox   = NULL;
+    if ( pAbc->pLibGen   == pGlobal->pLibGen   ) pAbc->pLibGen   = NULL;
+    if ( pAbc->pLibGen2  == pGlobal->pLibGen2  ) pAbc->pLibGen2  = NULL;
+    if ( pAbc->pLibSuper == pGlobal->pLibSuper ) pAbc->pLibSuper = NULL;
+    if ( pAbc->pLibScl   == pGlobal->pLibScl   ) pAbc->pLibScl   = NULL;
+    Abc_FrameEnd( pAbc );
+    Abc_FrameDeallocate( pAbc );
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
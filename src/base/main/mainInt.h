@@ -77,6 +77,7 @@ struct Abc_Frame_t_
     int             fAutoexac;     // marks the autoexec mode
     int             fBatchMode;    // batch mode flag
     int             fBridgeMode;   // bridge mode flag
+    int             fThreadLocal;  // the frame is private to one thread
     // save/load
     Abc_Ntk_t *     pNtkBest;        // the current network
     float           nBestNtkArea;   // best area
@@ -406,8 +406,9 @@ extern char *        Extra_UtilTildeExpand( char *fname );
 extern char *        Extra_UtilFileSearch( char *file, char *path, char *mode );
 extern void          (*Extra_UtilMMoutOfMemory)( long size );
 
-extern const char *  globalUtilOptarg;
-extern int           globalUtilOptind;
+// the option parser state is per thread, so that commands can be executed concurrently
+extern ABC_THREAD_LOCAL const char *  globalUtilOptarg;
+extern ABC_THREAD_LOCAL int           globalUtilOptind;
 
 /**AutomaticEnd***************************************************************/
 
@@ -41,10 +41,10 @@ ABC_NAMESPACE_IMPL_START
  *  Purpose: get option letter from argv.
  */
 
-const char * globalUtilOptarg;        // Global argument pointer (util_optarg)
-int    globalUtilOptind = 0;    // Global argv index (util_optind)
+ABC_THREAD_LOCAL const char * globalUtilOptarg;        // Global argument pointer (util_optarg)
+ABC_THREAD_LOCAL int    globalUtilOptind = 0;    // Global argv index (util_optind)
 
-static const char *pScanStr;
+static ABC_THREAD_LOCAL const char *pScanStr;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -23,6 +23,22 @@
 #include <string.h>
 #include <assert.h>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 #include "mem.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -70,6 +86,24 @@ struct Mem_Flex_t_
     int           nMemoryAlloc;  // memory allocated
 };
 
+// the chunk backend shared by the fixed and flexible memory managers
+#define MEM_CHUNK_HEADER  16         // keeps the alignment given by malloc()
+#define MEM_HUGE_PAGE     (1 << 21)  // the size of a transparent huge page
+#define MEM_NUMA_MIN      (1 << 16)  // the smaller chunks are not mapped separately for NUMA
+
+static int s_MemChunkMode = -1;      // -1 = unknown; otherwise MEM_CHUNK_HUGE | MEM_CHUNK_NUMA
+#if defined(__linux__)
+static size_t s_MemPageSize = 4096;  // the size of a regular page
+#endif
+
+#ifdef ABC_USE_PTHREADS
+// the chunks may be allocated by several threads before the mode is known
+static pthread_once_t s_MemChunkOnce = PTHREAD_ONCE_INIT;
+#endif
+
+// the header of a large chunk in Mem_Step_t (two ints, keeps the alignment)
+#define MEM_STEP_HEADER 8
+
 struct Mem_Step_t_
 {
     int             nMems;              // the number of fixed memory managers employed
@@ -85,6 +119,180 @@ struct Mem_Step_t_
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Sets the allocation backend used for the memory chunks.]
+
+  Description [With fHugePages, chunks are mapped with mmap(), aligned 
+  to and padded to 2MB, and advised for transparent huge pages; the 
+  memory managers started after this call use chunks of 2MB. With fNuma, 
+  each chunk is placed on the NUMA node of the thread that allocates it, 
+  which is the thread that owns the manager. By default, the backend is 
+  taken from the environment variables ABC_MEM_HUGEPAGES and ABC_MEM_NUMA,
+  which are read once, when the mode is first needed. Both options are 
+  ignored on systems other than Linux.]
+               
+  SideEffects [Should be called before any memory manager is started.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Mem_ChunkInitMode()
+{
+    char * pHuge = getenv( "ABC_MEM_HUGEPAGES" );
+    char * pNuma = getenv( "ABC_MEM_NUMA" );
+#if defined(__linux__)
+    long nPageSize = sysconf( _SC_PAGESIZE );
+    if ( nPageSize > 0 )
+        s_MemPageSize = (size_t)nPageSize;
+#endif
+    s_MemChunkMode = (pHuge && atoi(pHuge) > 0 ? MEM_CHUNK_HUGE : 0) | (pNuma && atoi(pNuma) > 0 ? MEM_CHUNK_NUMA : 0);
+}
+static void Mem_ChunkInit()
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_once( &s_MemChunkOnce, Mem_ChunkInitMode );
+#else
+    if ( s_MemChunkMode == -1 )
+        Mem_ChunkInitMode();
+#endif
+}
+void Mem_ChunkSetMode( int fHugePages, int fNuma )
+{
+    // read the environment first, so that it does not override this call later
+    Mem_ChunkInit();
+    s_MemChunkMode = (fHugePages ? MEM_CHUNK_HUGE : 0) | (fNuma ? MEM_CHUNK_NUMA : 0);
+}
+int Mem_ChunkReadMode()
+{
+    Mem_ChunkInit();
+#if defined(__linux__)
+    return s_MemChunkMode;
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of bytes in a chunk of the memory manager.]
+
+  Description [Returns the default size, unless chunks are backed by 
+  huge pages, in which case the chunk and its header fill one huge page.
+  With NUMA placement alone, the chunks mapped separately are extended 
+  so that the chunk and its header fill whole pages.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Mem_ChunkSize( int nBytesDefault )
+{
+    int Mode = Mem_ChunkReadMode();
+    if ( (Mode & MEM_CHUNK_HUGE) && nBytesDefault < MEM_HUGE_PAGE - MEM_CHUNK_HEADER )
+        return MEM_HUGE_PAGE - MEM_CHUNK_HEADER;
+#if defined(__linux__)
+    if ( Mode == MEM_CHUNK_NUMA && nBytesDefault >= MEM_NUMA_MIN - MEM_CHUNK_HEADER )
+        return (int)(((size_t)nBytesDefault + MEM_CHUNK_HEADER + s_MemPageSize - 1) & ~(s_MemPageSize - 1)) - MEM_CHUNK_HEADER;
+#endif
+    return nBytesDefault;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates one chunk of memory.]
+
+  Description [The header before the chunk stores the size of the mapping
+  (or 0 if the chunk came from malloc), so that the chunk can be released 
+  by Mem_ChunkFree() even if the backend was changed in between. With
+  NUMA placement alone, the chunks smaller than MEM_NUMA_MIN come from
+  malloc(): mapping them would waste the rest of the page and take three
+  system calls, while their pages are placed on the node of the thread
+  that first touches them, which is usually the owner of the manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Mem_ChunkAlloc( size_t nBytes )
+{
+    size_t * pHead;
+#if defined(__linux__)
+    int Mode = Mem_ChunkReadMode();
+    if ( Mode && (Mode != MEM_CHUNK_NUMA || nBytes + MEM_CHUNK_HEADER >= MEM_NUMA_MIN) )
+    {
+        // huge pages are only requested for the mappings aligned to and padded to them
+        size_t nAlign  = (Mode & MEM_CHUNK_HUGE) ? MEM_HUGE_PAGE : s_MemPageSize;
+        size_t nMapped = (nBytes + MEM_CHUNK_HEADER + nAlign - 1) & ~(nAlign - 1);
+        size_t nExtra  = (Mode & MEM_CHUNK_HUGE) ? MEM_HUGE_PAGE : 0;
+        char * pBase   = (char *)mmap( NULL, nMapped + nExtra, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if ( pBase != (char *)MAP_FAILED )
+        {
+            if ( nExtra )
+            {
+                // trim the mapping to start on a huge-page boundary
+                char * pAligned = (char *)(((size_t)pBase + MEM_HUGE_PAGE - 1) & ~(size_t)(MEM_HUGE_PAGE - 1));
+                if ( pAligned > pBase )
+                    munmap( pBase, pAligned - pBase );
+                if ( pAligned + nMapped < pBase + nMapped + nExtra )
+                    munmap( pAligned + nMapped, pBase + nExtra - pAligned );
+                pBase = pAligned;
+#ifdef MADV_HUGEPAGE
+                madvise( pBase, nMapped, MADV_HUGEPAGE );
+#endif
+            }
+#if defined(SYS_getcpu) && defined(SYS_mbind)
+            if ( Mode & MEM_CHUNK_NUMA )
+            {
+                // prefer the node of the calling thread; the pages are not touched yet
+                unsigned Cpu, Node;
+                if ( syscall( SYS_getcpu, &Cpu, &Node, NULL ) == 0 && Node < 8 * sizeof(unsigned long) - 1 )
+                {
+                    unsigned long Mask = 1UL << Node;
+                    syscall( SYS_mbind, pBase, nMapped, 1 /* MPOL_PREFERRED */, &Mask, 8 * sizeof(unsigned long), 0 );
+                }
+            }
+#endif
+            pHead = (size_t *)pBase;
+            pHead[0] = nMapped;
+            return pBase + MEM_CHUNK_HEADER;
+        }
+    }
+#endif
+    pHead = (size_t *)ABC_ALLOC( char, nBytes + MEM_CHUNK_HEADER );
+    pHead[0] = 0;
+    return (char *)pHead + MEM_CHUNK_HEADER;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the chunk allocated by Mem_ChunkAlloc().]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Mem_ChunkFree( char * pChunk )
+{
+    size_t * pHead;
+    if ( pChunk == NULL )
+        return;
+    pHead = (size_t *)(pChunk - MEM_CHUNK_HEADER);
+#if defined(__linux__)
+    if ( pHead[0] )
+    {
+        munmap( pHead, pHead[0] );
+        return;
+    }
+#endif
+    ABC_FREE( pHead );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Allocates memory pieces of fixed size.]
@@ -113,6 +321,7 @@ Mem_Fixed_t * Mem_FixedStart( int nEntrySize )
         p->nChunkSize = (1 << 10);
     else
         p->nChunkSize = (1<<16) / nEntrySize;
+    p->nChunkSize = Mem_ChunkSize( p->nChunkSize * nEntrySize ) / nEntrySize;
     if ( p->nChunkSize < 8 )
         p->nChunkSize = 8;
 
@@ -149,7 +358,7 @@ void Mem_FixedStop( Mem_Fixed_t * p, int fVerbose )
             p->nEntriesUsed, p->nEntriesMax, p->nEntrySize * p->nEntriesUsed, p->nMemoryAlloc );
     }
     for ( i = 0; i < p->nChunks; i++ )
-        ABC_FREE( p->pChunks[i] );
+        Mem_ChunkFree( p->pChunks[i] );
     ABC_FREE( p->pChunks );
     ABC_FREE( p );
 }
@@ -195,7 +404,7 @@ char * Mem_FixedEntryFetch( Mem_Fixed_t * p )
             p->nChunksAlloc *= 2;
             p->pChunks = ABC_REALLOC( char *, p->pChunks, p->nChunksAlloc ); 
         }
-        p->pEntriesFree = ABC_ALLOC( char, p->nEntrySize * p->nChunkSize );
+        p->pEntriesFree = Mem_ChunkAlloc( (size_t)p->nEntrySize * p->nChunkSize );
         p->nMemoryAlloc += p->nEntrySize * p->nChunkSize;
         // transform these entries into a linked list
         pTemp = p->pEntriesFree;
@@ -259,7 +468,7 @@ void Mem_FixedRestart( Mem_Fixed_t * p )
 
     // deallocate all chunks except the first one
     for ( i = 1; i < p->nChunks; i++ )
-        ABC_FREE( p->pChunks[i] );
+        Mem_ChunkFree( p->pChunks[i] );
     p->nChunks = 1;
     // transform these entries into a linked list
     pTemp = p->pChunks[0];
@@ -335,7 +544,7 @@ Mem_Flex_t * Mem_FlexStart()
     p->pCurrent      = NULL;
     p->pEnd          = NULL;
 
-    p->nChunkSize    = (1 << 12);
+    p->nChunkSize    = Mem_ChunkSize( (1 << 12) );
     p->nChunksAlloc  = 64;
     p->nChunks       = 0;
     p->pChunks       = ABC_ALLOC( char *, p->nChunksAlloc );
@@ -369,7 +578,7 @@ void Mem_FlexStop( Mem_Flex_t * p, int fVerbose )
             p->nEntriesUsed, p->nMemoryUsed, p->nMemoryAlloc );
     }
     for ( i = 0; i < p->nChunks; i++ )
-        ABC_FREE( p->pChunks[i] );
+        Mem_ChunkFree( p->pChunks[i] );
     ABC_FREE( p->pChunks );
     ABC_FREE( p );
 }
@@ -402,7 +611,7 @@ char * Mem_FlexEntryFetch( Mem_Flex_t * p, int nBytes )
             // (ideally, this should never happen)
             p->nChunkSize = 2 * nBytes;
         }
-        p->pCurrent = ABC_ALLOC( char, p->nChunkSize );
+        p->pCurrent = Mem_ChunkAlloc( p->nChunkSize );
         p->pEnd     = p->pCurrent + p->nChunkSize;
         p->nMemoryAlloc += p->nChunkSize;
         // add the chunk to the chunk storage
@@ -437,7 +646,7 @@ void Mem_FlexRestart( Mem_Flex_t * p )
         return;
     // deallocate all chunks except the first one
     for ( i = 1; i < p->nChunks; i++ )
-        ABC_FREE( p->pChunks[i] );
+        Mem_ChunkFree( p->pChunks[i] );
     p->nChunks  = 1;
     p->nMemoryAlloc = p->nChunkSize;
     // transform these entries into a linked list
@@ -552,6 +761,7 @@ void Mem_StepStop( Mem_Step_t * p, int fVerbose )
 ***********************************************************************/
 char * Mem_StepEntryFetch( Mem_Step_t * p, int nBytes )
 {
+    int * pChunk;
     if ( nBytes == 0 )
         return NULL;
     if ( nBytes > p->nMapSize )
@@ -565,8 +775,12 @@ char * Mem_StepEntryFetch( Mem_Step_t * p, int nBytes )
             p->nLargeChunksAlloc *= 2;
             p->pLargeChunks = (void **)ABC_REALLOC( char *, p->pLargeChunks, p->nLargeChunksAlloc ); 
         }
-        p->pLargeChunks[ p->nLargeChunks++ ] = ABC_ALLOC( char, nBytes );
-        return (char *)p->pLargeChunks[ p->nLargeChunks - 1 ];
+        // the header of a large chunk stores its index in the array and its size
+        pChunk = (int *)ABC_ALLOC( char, MEM_STEP_HEADER + nBytes );
+        pChunk[0] = p->nLargeChunks;
+        pChunk[1] = nBytes;
+        p->pLargeChunks[ p->nLargeChunks++ ] = pChunk;
+        return (char *)pChunk + MEM_STEP_HEADER;
     }
     return Mem_FixedEntryFetch( p->pMap[nBytes] );
 }
@@ -576,7 +790,8 @@ char * Mem_StepEntryFetch( Mem_Step_t * p, int nBytes )
 
   Synopsis    [Recycles the entry.]
 
-  Description []
+  Description [Large chunks are returned to the system right away, 
+  because they are rarely reused with the same size.]
                
   SideEffects []
 
@@ -585,11 +800,19 @@ char * Mem_StepEntryFetch( Mem_Step_t * p, int nBytes )
 ***********************************************************************/
 void Mem_StepEntryRecycle( Mem_Step_t * p, char * pEntry, int nBytes )
 {
+    int * pChunk, * pLast;
     if ( nBytes == 0 )
         return;
     if ( nBytes > p->nMapSize )
     {
-//        ABC_FREE( pEntry );
+        pChunk = (int *)(pEntry - MEM_STEP_HEADER);
+        assert( pChunk[1] == nBytes );
+        assert( p->pLargeChunks[pChunk[0]] == (void *)pChunk );
+        // move the last chunk into the place of this one
+        pLast = (int *)p->pLargeChunks[ --p->nLargeChunks ];
+        p->pLargeChunks[pChunk[0]] = pLast;
+        pLast[0] = pChunk[0];
+        ABC_FREE( pChunk );
         return;
     }
     Mem_FixedEntryRecycle( p->pMap[nBytes], pEntry );
@@ -611,6 +834,8 @@ int Mem_StepReadMemUsage( Mem_Step_t * p )
     int i, nMemTotal = 0;
     for ( i = 0; i < p->nMems; i++ )
         nMemTotal += p->pMems[i]->nMemoryAlloc;
+    for ( i = 0; i < p->nLargeChunks; i++ )
+        nMemTotal += ((int *)p->pLargeChunks[i])[1];
     return nMemTotal;
 }
 
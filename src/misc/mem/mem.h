@@ -34,11 +34,21 @@ typedef struct Mem_Fixed_t_    Mem_Fixed_t;
 typedef struct Mem_Flex_t_     Mem_Flex_t;     
 typedef struct Mem_Step_t_     Mem_Step_t;     
 
+// the backends of the memory chunks (see Mem_ChunkSetMode)
+#define MEM_CHUNK_HUGE   1           // mmap() chunks advised for huge pages
+#define MEM_CHUNK_NUMA   2           // place chunks on the node of the allocating thread
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
  
 /*=== mem.c ===========================================================*/
+// chunk allocation backend
+extern void          Mem_ChunkSetMode( int fHugePages, int fNuma );
+extern int           Mem_ChunkReadMode();
+extern int           Mem_ChunkSize( int nBytesDefault );
+extern char *        Mem_ChunkAlloc( size_t nBytes );
+extern void          Mem_ChunkFree( char * pChunk );
 // fixed-size-block memory manager
 extern Mem_Fixed_t * Mem_FixedStart( int nEntrySize );
 extern void          Mem_FixedStop( Mem_Fixed_t * p, int fVerbose );
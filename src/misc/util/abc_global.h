@@ -234,6 +234,13 @@ typedef unsigned __int64 ABC_UINT64_T;
    #error unknown platform
 #endif /* defined(PLATFORM) */
 
+// thread-local storage (used for the scratch data of the procedures called concurrently)
+#ifdef _MSC_VER
+  #define ABC_THREAD_LOCAL __declspec(thread)
+#else
+  #define ABC_THREAD_LOCAL __thread
+#endif
+
 #ifdef LIN
   #define ABC_CONST(number) number ## ULL 
 #else // LIN64 and windows
@@ -554,7 +561,18 @@ extern unsigned Abc_Random( int fReset );
 extern word     Abc_RandomW( int fReset );
 
 // pthreads
-extern void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
+typedef struct Util_Sched_t_ Util_Sched_t;
+typedef struct Util_Task_t_  Util_Task_t;
+extern void           Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int fVerbose );
+extern Util_Sched_t * Util_SchedStart( int nWorkers );
+extern void           Util_SchedStop( Util_Sched_t * p );
+extern int            Util_SchedWorkerNum( Util_Sched_t * p );
+extern void           Util_SchedSetTimeOut( Util_Sched_t * p, int TimeOut );
+extern void           Util_SchedCancel( Util_Sched_t * p );
+extern int            Util_SchedIsCancelled( Util_Sched_t * p );
+extern Util_Task_t *  Util_SchedSubmit( Util_Sched_t * p, int (*pFunc)(void *), void * pData );
+extern int            Util_SchedWait( Util_Sched_t * p, Util_Task_t * pTask );
+extern void           Util_SchedWaitAll( Util_Sched_t * p );
 
 ABC_NAMESPACE_HEADER_END
 
@@ -55,9 +55,21 @@ ABC_NAMESPACE_IMPL_START
 
 /**Function*************************************************************
 
-  Synopsis    []
-
-  Description []
+  Synopsis    [Task scheduler.]
+
+  Description [The scheduler owns a fixed set of worker threads. Each 
+  worker has its own deque of tasks: the tasks submitted by a worker are
+  pushed to the bottom of its deque and popped from there (LIFO), while
+  idle workers steal from the top of the other deques (FIFO). Tasks 
+  submitted from outside of the workers are spread among the deques in
+  a round-robin order. Idle workers sleep on a condition variable. 
+  Each task is a future: Util_SchedWait() returns the value returned by 
+  the user's function; when called by a worker, it executes other tasks 
+  while waiting. After the cancellation (explicit or by the timeout), the 
+  tasks that did not start are completed without running and return -1; 
+  the running tasks may poll Util_SchedIsCancelled() to stop early. 
+  Util_SchedWaitAll() releases the completed tasks, so the pointers 
+  returned by Util_SchedSubmit() should not be used after it.]
                
   SideEffects []
 
@@ -65,123 +77,355 @@ ABC_NAMESPACE_IMPL_START
 
 ***********************************************************************/
 
+struct Util_Task_t_
+{
+    int        (*pFunc)(void *);     // user's function
+    void *       pData;              // user's data
+    int          Result;             // the value returned by the function
+    int          fDone;              // the task is completed
+};
+
 #ifndef ABC_USE_PTHREADS
 
-void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
+struct Util_Sched_t_
 {
-    void * pData; int i;
-    Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
-        pUserFunc( pData );
+    Vec_Ptr_t *  vTasks;             // all tasks
+    abctime      TimeStop;           // the deadline (or 0)
+    int          fCancel;            // the tasks are cancelled
+};
+
+Util_Sched_t * Util_SchedStart( int nWorkers )
+{
+    Util_Sched_t * p = ABC_CALLOC( Util_Sched_t, 1 );
+    p->vTasks = Vec_PtrAlloc( 100 );
+    return p;
+}
+void Util_SchedStop( Util_Sched_t * p )
+{
+    Vec_PtrFreeFree( p->vTasks );
+    ABC_FREE( p );
+}
+int Util_SchedWorkerNum( Util_Sched_t * p )
+{
+    return 1;
+}
+void Util_SchedSetTimeOut( Util_Sched_t * p, int TimeOut )
+{
+    p->TimeStop = TimeOut > 0 ? Abc_Clock() + (abctime)TimeOut * CLOCKS_PER_SEC : 0;
+}
+void Util_SchedCancel( Util_Sched_t * p )
+{
+    p->fCancel = 1;
+}
+int Util_SchedIsCancelled( Util_Sched_t * p )
+{
+    if ( !p->fCancel && p->TimeStop && Abc_Clock() > p->TimeStop )
+        p->fCancel = 1;
+    return p->fCancel;
+}
+Util_Task_t * Util_SchedSubmit( Util_Sched_t * p, int (*pFunc)(void *), void * pData )
+{
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 );
+    pTask->pFunc  = pFunc;
+    pTask->pData  = pData;
+    pTask->Result = Util_SchedIsCancelled(p) ? -1 : pFunc( pData );
+    pTask->fDone  = 1;
+    Vec_PtrPush( p->vTasks, pTask );
+    return pTask;
+}
+int Util_SchedWait( Util_Sched_t * p, Util_Task_t * pTask )
+{
+    assert( pTask->fDone );
+    return pTask->Result;
+}
+void Util_SchedWaitAll( Util_Sched_t * p )
+{
+    Util_Task_t * pTask; int i;
+    Vec_PtrForEachEntry( Util_Task_t *, p->vTasks, pTask, i )
+        ABC_FREE( pTask );
+    Vec_PtrClear( p->vTasks );
 }
 
 #else // pthreads are used
 
-#define PAR_THR_MAX 100
-typedef struct Util_ThData_t_
+typedef struct Util_Deque_t_
 {
-    void *       pUserData;
-    int        (*pUserFunc)(void *);
-    int          iThread;
-    int          nTimeOut;
-    atomic_bool  fWorking;
-} Util_ThData_t;
-
-void * Util_Thread( void * pArg )
+    pthread_mutex_t Mutex;
+    Util_Task_t ** pTasks;           // the tasks
+    int          iBeg;               // the top (stealing end)
+    int          iEnd;               // the bottom (owner's end)
+    int          nCap;               // the capacity
+} Util_Deque_t;
+
+struct Util_Sched_t_
 {
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
+    int          nWorkers;           // the number of worker threads
+    pthread_t *  pThreads;           // the worker threads
+    Util_Deque_t * pDeques;          // one deque per worker
+    pthread_key_t Key;               // the number of the current worker plus one
+    pthread_mutex_t Mutex;           // protects the sleeping and the completion
+    pthread_cond_t CondWork;         // signaled when a task is submitted
+    pthread_cond_t CondDone;         // signaled when a task is completed
+    atomic_int   nQueued;            // the number of tasks in the deques
+    int          nPending;           // the number of tasks not completed
+    int          iNext;              // the next deque for external tasks
+    int          fStop;              // the workers should exit
+    atomic_bool  fCancel;            // the tasks are cancelled
+    abctime      TimeStop;           // the deadline (or 0)
+    Vec_Ptr_t *  vTasks;             // all tasks
+};
+
+typedef struct Util_ThArg_t_
+{
+    Util_Sched_t * p;
+    int          iWorker;
+} Util_ThArg_t;
 
-    Util_ThData_t * pThData = (Util_ThData_t *)pArg;
+// the counter of queued tasks is updated under the lock of the deque,
+// so that it is incremented before the task can be taken by another worker
+static void Util_DequePush( Util_Sched_t * p, Util_Deque_t * q, Util_Task_t * pTask )
+{
+    pthread_mutex_lock( &q->Mutex );
+    if ( q->iEnd == q->nCap )
+    {
+        if ( q->iBeg > 0 )
+        {
+            memmove( q->pTasks, q->pTasks + q->iBeg, sizeof(Util_Task_t *) * (q->iEnd - q->iBeg) );
+            q->iEnd -= q->iBeg;
+            q->iBeg  = 0;
+        }
+        if ( q->iEnd == q->nCap )
+        {
+            q->nCap   = q->nCap ? 2 * q->nCap : 64;
+            q->pTasks = ABC_REALLOC( Util_Task_t *, q->pTasks, q->nCap );
+        }
+    }
+    q->pTasks[q->iEnd++] = pTask;
+    atomic_fetch_add_explicit( &p->nQueued, 1, memory_order_acq_rel );
+    pthread_mutex_unlock( &q->Mutex );
+}
+static Util_Task_t * Util_DequePop( Util_Sched_t * p, Util_Deque_t * q, int fSteal )
+{
+    Util_Task_t * pTask = NULL;
+    pthread_mutex_lock( &q->Mutex );
+    if ( q->iBeg < q->iEnd )
+    {
+        pTask = fSteal ? q->pTasks[q->iBeg++] : q->pTasks[--q->iEnd];
+        atomic_fetch_sub_explicit( &p->nQueued, 1, memory_order_acq_rel );
+    }
+    if ( q->iBeg == q->iEnd )
+        q->iBeg = q->iEnd = 0;
+    pthread_mutex_unlock( &q->Mutex );
+    return pTask;
+}
+static inline int Util_SchedCurWorker( Util_Sched_t * p )
+{
+    return (int)(ABC_PTRINT_T)pthread_getspecific( p->Key ) - 1;
+}
+// takes a task from the worker's own deque or steals it from another one
+static Util_Task_t * Util_SchedGetTask( Util_Sched_t * p, int iWorker )
+{
+    Util_Task_t * pTask = NULL; int i;
+    if ( atomic_load_explicit(&p->nQueued, memory_order_acquire) == 0 )
+        return NULL;
+    if ( iWorker >= 0 )
+        pTask = Util_DequePop( p, p->pDeques + iWorker, 0 );
+    for ( i = 1; !pTask && i <= p->nWorkers; i++ )
+        pTask = Util_DequePop( p, p->pDeques + (Abc_MaxInt(iWorker, 0) + i) % p->nWorkers, 1 );
+    return pTask;
+}
+static void Util_SchedExecute( Util_Sched_t * p, Util_Task_t * pTask )
+{
+    int Result = Util_SchedIsCancelled(p) ? -1 : pTask->pFunc( pTask->pData );
+    pthread_mutex_lock( &p->Mutex );
+    pTask->Result = Result;
+    pTask->fDone  = 1;
+    p->nPending--;
+    pthread_cond_broadcast( &p->CondDone );
+    pthread_mutex_unlock( &p->Mutex );
+}
+static void * Util_SchedWorker( void * pArg )
+{
+    Util_ThArg_t * pThArg = (Util_ThArg_t *)pArg;
+    Util_Sched_t * p = pThArg->p;
+    int iWorker = pThArg->iWorker;
+    Util_Task_t * pTask;
+    ABC_FREE( pThArg );
+    pthread_setspecific( p->Key, (void *)(ABC_PTRINT_T)(iWorker + 1) );
     while ( 1 )
     {
-        while ( !atomic_load_explicit((atomic_bool *)&pThData->fWorking, memory_order_acquire) )
-            nanosleep(&pause_duration, NULL);
-        if ( pThData->pUserData == NULL )
+        if ( (pTask = Util_SchedGetTask(p, iWorker)) )
+        {
+            Util_SchedExecute( p, pTask );
+            continue;
+        }
+        pthread_mutex_lock( &p->Mutex );
+        while ( atomic_load_explicit(&p->nQueued, memory_order_acquire) == 0 && !p->fStop )
+            pthread_cond_wait( &p->CondWork, &p->Mutex );
+        if ( atomic_load_explicit(&p->nQueued, memory_order_acquire) == 0 && p->fStop )
         {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
+            pthread_mutex_unlock( &p->Mutex );
+            break;
         }
-        pThData->pUserFunc( pThData->pUserData );
-        atomic_store_explicit(&pThData->fWorking, false, memory_order_release);
+        pthread_mutex_unlock( &p->Mutex );
     }
-    assert( 0 );
     return NULL;
 }
 
-void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
+Util_Sched_t * Util_SchedStart( int nWorkers )
 {
-    //abctime clkStart = Abc_Clock();
-    Util_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack = NULL;
+    Util_Sched_t * p = ABC_CALLOC( Util_Sched_t, 1 );
     int i, status;
-    fflush( stdout );
-    if ( nProcs <= 2 ) {
-        void * pData; int i;
-        Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
-            pUserFunc( pData );
-        return;
-    }
-    // subtract manager thread
-    nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
+    assert( nWorkers >= 1 );
+    p->nWorkers = nWorkers;
+    p->pThreads = ABC_CALLOC( pthread_t, nWorkers );
+    p->pDeques  = ABC_CALLOC( Util_Deque_t, nWorkers );
+    p->vTasks   = Vec_PtrAlloc( 100 );
+    atomic_store_explicit( &p->nQueued, 0, memory_order_release );
+    atomic_store_explicit( &p->fCancel, false, memory_order_release );
+    pthread_key_create( &p->Key, NULL );
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->CondWork, NULL );
+    pthread_cond_init( &p->CondDone, NULL );
+    for ( i = 0; i < nWorkers; i++ )
+        pthread_mutex_init( &p->pDeques[i].Mutex, NULL );
+    for ( i = 0; i < nWorkers; i++ )
     {
-        ThData[i].pUserData = NULL;
-        ThData[i].pUserFunc = pUserFunc;
-        ThData[i].iThread   = i;
-        ThData[i].nTimeOut  = TimeOut;
-        atomic_store_explicit(&ThData[i].fWorking, false, memory_order_release);
-        status = pthread_create( WorkerThread + i, NULL, Util_Thread, (void *)(ThData + i) );  assert( status == 0 );
+        Util_ThArg_t * pThArg = ABC_ALLOC( Util_ThArg_t, 1 );
+        pThArg->p       = p;
+        pThArg->iWorker = i;
+        status = pthread_create( p->pThreads + i, NULL, Util_SchedWorker, (void *)pThArg );  assert( status == 0 );
     }
-
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
-
-    // look at the threads
-    vStack = Vec_PtrDup( (Vec_Ptr_t *)vData );
-    while ( Vec_PtrSize(vStack) > 0 )
+    return p;
+}
+void Util_SchedStop( Util_Sched_t * p )
+{
+    int i;
+    Util_SchedWaitAll( p );
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->CondWork );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 0; i < p->nWorkers; i++ )
+        pthread_join( p->pThreads[i], NULL );
+    for ( i = 0; i < p->nWorkers; i++ )
     {
-        for ( i = 0; i < nProcs; i++ )
-        {
-            if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-                continue;
-            ThData[i].pUserData = Vec_PtrPop( vStack );
-            atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
-            break;
-        }
+        pthread_mutex_destroy( &p->pDeques[i].Mutex );
+        ABC_FREE( p->pDeques[i].pTasks );
     }
-    Vec_PtrFree( vStack );    
-    
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
+    pthread_cond_destroy( &p->CondDone );
+    pthread_cond_destroy( &p->CondWork );
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_key_delete( p->Key );
+    Vec_PtrFreeFree( p->vTasks );
+    ABC_FREE( p->pDeques );
+    ABC_FREE( p->pThreads );
+    ABC_FREE( p );
+}
+int Util_SchedWorkerNum( Util_Sched_t * p )
+{
+    return p->nWorkers;
+}
+void Util_SchedSetTimeOut( Util_Sched_t * p, int TimeOut )
+{
+    p->TimeStop = TimeOut > 0 ? Abc_Clock() + (abctime)TimeOut * CLOCKS_PER_SEC : 0;
+}
+void Util_SchedCancel( Util_Sched_t * p )
+{
+    atomic_store_explicit( &p->fCancel, true, memory_order_release );
+}
+int Util_SchedIsCancelled( Util_Sched_t * p )
+{
+    if ( atomic_load_explicit(&p->fCancel, memory_order_acquire) )
+        return 1;
+    if ( p->TimeStop && Abc_Clock() > p->TimeStop )
     {
-        if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-            i = -1; // Start from the beginning again
-        nanosleep(&pause_duration, NULL);
+        Util_SchedCancel( p );
+        return 1;
     }
-
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
+    return 0;
+}
+Util_Task_t * Util_SchedSubmit( Util_Sched_t * p, int (*pFunc)(void *), void * pData )
+{
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 );
+    int iWorker = Util_SchedCurWorker( p );
+    pTask->pFunc  = pFunc;
+    pTask->pData  = pData;
+    pthread_mutex_lock( &p->Mutex );
+    Vec_PtrPush( p->vTasks, pTask );
+    p->nPending++;
+    if ( iWorker < 0 )
+        iWorker = p->iNext++ % p->nWorkers;
+    pthread_mutex_unlock( &p->Mutex );
+    Util_DequePush( p, p->pDeques + iWorker, pTask );
+    pthread_mutex_lock( &p->Mutex );
+    pthread_cond_signal( &p->CondWork );
+    pthread_mutex_unlock( &p->Mutex );
+    return pTask;
+}
+int Util_SchedWait( Util_Sched_t * p, Util_Task_t * pTask )
+{
+    int iWorker = Util_SchedCurWorker( p );
+    Util_Task_t * pOther;
+    pthread_mutex_lock( &p->Mutex );
+    while ( !pTask->fDone )
     {
-        ThData[i].pUserData = NULL;
-        atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
+        // a worker helps with the queued tasks instead of blocking
+        if ( iWorker >= 0 && atomic_load_explicit(&p->nQueued, memory_order_acquire) > 0 )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            if ( (pOther = Util_SchedGetTask(p, iWorker)) )
+                Util_SchedExecute( p, pOther );
+            pthread_mutex_lock( &p->Mutex );
+            continue;
+        }
+        pthread_cond_wait( &p->CondDone, &p->Mutex );
     }
-
-    // Join threads
-    for ( i = 0; i < nProcs; i++ )
-        pthread_join( WorkerThread[i], NULL );
-
-    //if ( fVerbose )
-    //    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );    
+    pthread_mutex_unlock( &p->Mutex );
+    return pTask->Result;
+}
+void Util_SchedWaitAll( Util_Sched_t * p )
+{
+    Util_Task_t * pTask; int i;
+    pthread_mutex_lock( &p->Mutex );
+    while ( p->nPending > 0 )
+        pthread_cond_wait( &p->CondDone, &p->Mutex );
+    // the completed tasks are not referenced by the workers
+    Vec_PtrForEachEntry( Util_Task_t *, p->vTasks, pTask, i )
+        ABC_FREE( pTask );
+    Vec_PtrClear( p->vTasks );
+    pthread_mutex_unlock( &p->Mutex );
 }
 
 #endif // pthreads are used
 
+/**Function*************************************************************
+
+  Synopsis    [Runs the user's function on each entry of the array.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int fVerbose )
+{
+    Util_Sched_t * p;
+    void * pData; int i;
+    fflush( stdout );
+    if ( nProcs <= 1 ) {
+        Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
+            pUserFunc( pData );
+        return;
+    }
+    p = Util_SchedStart( nProcs );
+    Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
+        Util_SchedSubmit( p, pUserFunc, pData );
+    Util_SchedStop( p );
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -95,6 +95,8 @@ extern void            Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars );
 extern int             Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 extern int             Dar_ManRewriteCertificates( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, Vec_Ptr_t * certificates );
 extern Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int fVerbose );
+extern Vec_Ptr_t *     Dar_ManComputeCutsPar( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int nThreads, int fVerbose );
+extern void            Dar_ManStopCutsPar( Vec_Ptr_t * vMemCuts );
 /*=== darRefact.c ========================================================*/
 extern void            Dar_ManDefaultRefParams( Dar_RefPar_t * pPars );
 extern int             Dar_ManRefactor( Aig_Man_t * pAig, Dar_RefPar_t * pPars );
@@ -580,6 +580,107 @@ Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtM
     return pMemCuts;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts for the AIG using several threads.]
+
+  Description [Computes the same cuts as Dar_ManComputeCuts(). The nodes
+  are visited level by level and the nodes of a large level are divided
+  among the threads. Since the cuts of a node depend only on the cuts of
+  its fanins, the result does not depend on the number of threads. Each 
+  thread allocates the cuts from its own memory manager. Returns the array
+  of memory managers, to be freed by Dar_ManStopCutsPar().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Dar_CutPar_t_ Dar_CutPar_t;
+struct Dar_CutPar_t_
+{
+    Dar_Man_t **     ppMans;         // the managers of the threads
+    int *            pNodes;         // the nodes ordered by level
+    int              fSkipTtMin;     // skip truth table minimization
+};
+static void Dar_ManComputeCutsRange( void * pData, int iThread, int iBeg, int iEnd )
+{
+    Dar_CutPar_t * pPar = (Dar_CutPar_t *)pData;
+    Dar_Man_t * p = pPar->ppMans[iThread];
+    int i;
+    for ( i = iBeg; i < iEnd; i++ )
+        Dar_ObjComputeCuts( p, Aig_ManObj(p->pAig, pPar->pNodes[i]), pPar->fSkipTtMin );
+}
+Vec_Ptr_t * Dar_ManComputeCutsPar( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int nThreads, int fVerbose )
+{
+    Dar_Man_t ** ppMans;
+    Dar_RwrPar_t Pars, * pPars = &Pars; 
+    Dar_CutPar_t Par, * pPar = &Par;
+    Vec_Ptr_t * vMemCuts;
+    Vec_Int_t * vNodes, * vStarts;
+    Aig_Obj_t * pObj;
+    int i, t;
+    abctime clk = Abc_Clock();
+    vMemCuts = Vec_PtrAlloc( nThreads );
+    if ( nThreads <= 1 )
+    {
+        Vec_PtrPush( vMemCuts, Dar_ManComputeCuts( pAig, nCutsMax, fSkipTtMin, fVerbose ) );
+        return vMemCuts;
+    }
+    // remove dangling nodes
+    Aig_ManCleanup( pAig );
+    // create default parameters
+    Dar_ManDefaultRwrParams( pPars );
+    pPars->nCutsMax = nCutsMax;
+    // create one rewriting manager for each thread
+    ppMans = ABC_ALLOC( Dar_Man_t *, nThreads );
+    for ( t = 0; t < nThreads; t++ )
+        ppMans[t] = Dar_ManStart( pAig, pPars );
+    // set elementary cuts for the PIs
+    Dar_ObjPrepareCuts( ppMans[0], Aig_ManConst1(pAig) );
+    Aig_ManForEachCi( pAig, pObj, i )
+        Dar_ObjPrepareCuts( ppMans[0], pObj );
+    // compute cuts for each level
+    vNodes = Aig_ManLevelizeNodes( pAig, &vStarts );
+    pPar->ppMans     = ppMans;
+    pPar->pNodes     = Vec_IntArray( vNodes );
+    pPar->fSkipTtMin = fSkipTtMin;
+    Aig_ManLevelRunPar( vStarts, nThreads, AIG_LEVEL_PAR_MIN, Dar_ManComputeCutsRange, pPar );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vStarts );
+    // print verbose stats
+    if ( fVerbose )
+    {
+        double MemUsage = 0;
+        int nCuts, nCutsK;
+        for ( t = 0; t < nThreads; t++ )
+            MemUsage += Aig_MmFixedReadMemUsage(ppMans[t]->pMemCuts);
+        nCuts = Dar_ManCutCount( pAig, &nCutsK );
+        printf( "Nodes = %6d. Total cuts = %6d. 4-input cuts = %6d.\n",
+            Aig_ManObjNum(pAig), nCuts, nCutsK );
+        printf( "Cut size = %2d. Truth size = %2d. Total mem = %5.2f MB  ",
+            (int)sizeof(Dar_Cut_t), (int)4, MemUsage/(1<<20) );
+        ABC_PRT( "Runtime", Abc_Clock() - clk );
+    }
+    // collect the cuts and stop the managers
+    for ( t = 0; t < nThreads; t++ )
+    {
+        Vec_PtrPush( vMemCuts, ppMans[t]->pMemCuts );
+        ppMans[t]->pMemCuts = NULL;
+        Dar_ManStop( ppMans[t] );
+    }
+    ABC_FREE( ppMans );
+    return vMemCuts;
+}
+void Dar_ManStopCutsPar( Vec_Ptr_t * vMemCuts )
+{
+    Aig_MmFixed_t * pMemCuts;
+    int i;
+    Vec_PtrForEachEntry( Aig_MmFixed_t *, vMemCuts, pMemCuts, i )
+        Aig_MmFixedStop( pMemCuts, 0 );
+    Vec_PtrFree( vMemCuts );
+}
+
 
 
 ////////////////////////////////////////////////////////////////////////
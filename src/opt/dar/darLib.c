@@ -23,6 +23,16 @@
 #include "dar.h"
 #include "certificate.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -106,7 +116,16 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
-static Dar_Lib_t * s_DarLib = NULL;
+// the library is updated during rewriting, so each thread has its own copy
+static ABC_THREAD_LOCAL Dar_Lib_t * s_DarLib = NULL;
+
+#ifdef ABC_USE_PTHREADS
+// frees the copy of a thread that exits without calling Dar_LibStop()
+static pthread_key_t  s_DarLibKey;
+static pthread_once_t s_DarLibOnce = PTHREAD_ONCE_INIT;
+static void Dar_LibFreeThread( void * p );
+static void Dar_LibKeyCreate() { pthread_key_create( &s_DarLibKey, Dar_LibFreeThread ); }
+#endif
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -194,6 +213,7 @@ void Dar_LibFree( Dar_Lib_t * p )
 ***********************************************************************/
 int Dar_LibReturnClass( unsigned uTruth )
 {
+    Dar_LibStart();
     return s_DarLib->pMap[uTruth & 0xffff];
 }
 
@@ -478,8 +498,10 @@ void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibObj_t * pObj, int Class, int fColl
 ***********************************************************************/
 void Dar_LibPrepare( int nSubgraphs )
 {
-    Dar_Lib_t * p = s_DarLib;
+    Dar_Lib_t * p;
     int i, k, nNodes0Total;
+    Dar_LibStart();
+    p = s_DarLib;
     if ( p->nSubgraphs == nSubgraphs )
         return;
 
@@ -584,13 +606,21 @@ Dar_Lib_t * Dar_LibRead()
 
   Synopsis    [Starts the library.]
 
-  Description []
+  Description [The library of each thread is registered with a key whose
+  destructor frees it when the thread exits, so that the worker threads,
+  which start it on demand, do not have to stop it explicitly.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void Dar_LibFreeThread( void * p )
+{
+    Dar_LibFree( (Dar_Lib_t *)p );
+}
+#endif
 void Dar_LibStart()
 {
 //    abctime clk = Abc_Clock();
@@ -598,6 +628,10 @@ void Dar_LibStart()
         return;
     assert( s_DarLib == NULL );
     s_DarLib = Dar_LibRead();
+#ifdef ABC_USE_PTHREADS
+    pthread_once( &s_DarLibOnce, Dar_LibKeyCreate );
+    pthread_setspecific( s_DarLibKey, s_DarLib );
+#endif
 //    printf( "The 4-input library started with %d nodes and %d subgraphs. ", s_DarLib->nObjs - 4, s_DarLib->nSubgrTotal );
 //    ABC_PRT( "Time", Abc_Clock() - clk );
 }
@@ -616,6 +650,9 @@ void Dar_LibStart()
 void Dar_LibStop()
 {
     assert( s_DarLib != NULL );
+#ifdef ABC_USE_PTHREADS
+    pthread_setspecific( s_DarLibKey, NULL );
+#endif
     Dar_LibFree( s_DarLib );
     s_DarLib = NULL;
 }
@@ -206,15 +206,13 @@ void Dar_TruthPermute_int( int * pMints, int nMints, char * pPerm, int nVars, in
 unsigned Dar_TruthPermute( unsigned Truth, char * pPerms, int nVars, int fReverse )
 {
     unsigned Result;
-    int * pMints;
-    int * pMintsP;
+    int pMints[32];
+    int pMintsP[32];
     int nMints;
     int i, m;
 
     assert( nVars < 6 );
     nMints  = (1 << nVars);
-    pMints  = ABC_ALLOC( int, nMints );
-    pMintsP = ABC_ALLOC( int, nMints );
     for ( i = 0; i < nMints; i++ )
         pMints[i] = i;
 
@@ -233,10 +231,6 @@ unsigned Dar_TruthPermute( unsigned Truth, char * pPerms, int nVars, int fRevers
             if ( Truth & (1 << m) )
                 Result |= (1 << pMintsP[m]);
     }
-
-    ABC_FREE( pMints );
-    ABC_FREE( pMintsP );
-
     return Result;
 }
 
@@ -30,6 +30,7 @@
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
 
+#define CEC_PAR_THR_MAX 100     // the max number of concurrent threads
 
 
 ABC_NAMESPACE_HEADER_START
@@ -108,6 +109,7 @@ struct Cec_ParFra_t_
     int              nCallsRecycle; // calls to perform before recycling SAT solver
     int              nSatVarMax;    // the max number of SAT variables
     int              nGenIters;     // pattern generation iterations
+    int              nProcs;        // the number of concurrent threads for SAT sweeping
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -131,10 +133,12 @@ struct Cec_ParCec_t_
 {
     int              nBTLimit;      // conflict limit at a node
     int              TimeLimit;     // the runtime limit in seconds
+    int              nProcs;        // the number of concurrent threads
 //    int              fFirstStop;    // stop on the first sat output
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              SolverType;    // the SAT solver used by naive checking (Sat_Backend_t)
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -23,6 +23,7 @@
 #include "aig/gia/giaAig.h"
 #include "misc/extra/extra.h"
 #include "sat/cnf/cnf.h"
+#include "sat/bsat/satBackend.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -226,7 +227,7 @@ int Cec_ManHandleSpecialCases( Gia_Man_t * p, Cec_ParCec_t * pPars )
 int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
 {
     Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 0, 0, 0 );
-    sat_solver * pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
+    sat_backend * pSat = sat_backend_start( pPars->SolverType );
     Gia_Obj_t * pObj0, * pObj1;
     abctime clkStart = Abc_Clock();
     int nPairs = Gia_ManPoNum(p)/2;
@@ -234,6 +235,10 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
     int i, iVar0, iVar1, pLits[2], status, RetValue;
     ProgressBar * pProgress = Extra_ProgressBarStart( stdout, nPairs );
     assert( Gia_ManPoNum(p) % 2 == 0 );
+    RetValue = sat_backend_addcnf( pSat, pCnf );
+    assert( RetValue );
+    if ( pPars->fVerbose )
+        printf( "Naive checking of %d output pairs using %s.\n", nPairs, sat_backend_name(pPars->SolverType) );
     for ( i = 0; i < nPairs; i++ )
     {
         if ( (i & 0xFF) == 0 )
@@ -259,12 +264,12 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
         pLits[1] = Abc_Var2Lit( iVar1, 0 );
         // check direct
         pLits[0] = lit_neg(pLits[0]);
-        status = sat_solver_solve( pSat, pLits, pLits + 2, pPars->nBTLimit, 0, 0, 0 );
+        status = sat_backend_solve( pSat, pLits, 2, pPars->nBTLimit );
         if ( status == l_False )
         {
             pLits[0] = lit_neg( pLits[0] );
             pLits[1] = lit_neg( pLits[1] );
-            RetValue = sat_solver_addclause( pSat, pLits, pLits + 2 );
+            RetValue = sat_backend_addclause( pSat, pLits, 2 );
             assert( RetValue );
         }
         else if ( status == l_True )
@@ -279,12 +284,12 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
             continue;
         }
         // check inverse
-        status = sat_solver_solve( pSat, pLits, pLits + 2, pPars->nBTLimit, 0, 0, 0 );
+        status = sat_backend_solve( pSat, pLits, 2, pPars->nBTLimit );
         if ( status == l_False )
         {
             pLits[0] = lit_neg( pLits[0] );
             pLits[1] = lit_neg( pLits[1] );
-            RetValue = sat_solver_addclause( pSat, pLits, pLits + 2 );
+            RetValue = sat_backend_addclause( pSat, pLits, 2 );
             assert( RetValue );
         }
         else if ( status == l_True )
@@ -304,7 +309,7 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
     printf( "UNSAT = %6d.  SAT = %6d.   UNDEC = %6d.  Trivial = %6d.  ", nUnsats, nSats, nUndecs, nTrivs );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
     Cnf_DataFree( pCnf );
-    sat_solver_delete( pSat );
+    sat_backend_stop( pSat );
     if ( nSats )
         return 0;
     if ( nUndecs )
@@ -161,6 +161,7 @@ void Cec_ManCecSetDefaultParams( Cec_ParCec_t * p )
     memset( p, 0, sizeof(Cec_ParCec_t) );
     p->nBTLimit       =    1000;  // conflict limit at a node
     p->TimeLimit      =       0;  // the runtime limit in seconds
+    p->nProcs         =       1;  // the number of concurrent threads
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fUseSmartCnf   =       0;  // use smart CNF computation
     p->fRewriting     =       0;  // enables AIG rewriting
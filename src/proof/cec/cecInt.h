@@ -89,6 +89,8 @@ struct Cec_ManSat_t_
     int              nRecycles;      // the number of times SAT solver was recycled
     int              nCallsSince;    // the number of calls since the last recycle
     Vec_Ptr_t *      vFanins;        // fanins of the CNF node
+    Vec_Ptr_t *      vFrontier;      // frontier of the CNF construction
+    Vec_Int_t *      vLits;          // literals of the clause being added
     // counter-examples
     Vec_Int_t *      vCex;           // the latest counter-example
     Vec_Int_t *      vVisits;        // temporary array for visited nodes  
@@ -270,7 +270,7 @@ void Cec_ManTransformClasses( Gia_Man_t * p )
     Gia_Obj_t * pObj;
     int i;
     assert( p->pReprs && p->pNexts && p->pIso );
-    memset( p->pReprs, 0, sizeof(int) * Gia_ManObjNum(p) );
+    memset( p->pReprs, 0, sizeof(Gia_Rpr_t) * Gia_ManObjNum(p) );
     memset( p->pNexts, 0, sizeof(int) * Gia_ManObjNum(p) );
     Gia_ManForEachObj( p, pObj, i )
     {
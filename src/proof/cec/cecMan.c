@@ -55,6 +55,8 @@ Cec_ManSat_t * Cec_ManSatCreate( Gia_Man_t * pAig, Cec_ParSat_t * pPars )
     p->pSatVars     = ABC_CALLOC( int, Gia_ManObjNum(pAig) );
     p->vUsedNodes   = Vec_PtrAlloc( 1000 );
     p->vFanins      = Vec_PtrAlloc( 100 );
+    p->vFrontier    = Vec_PtrAlloc( 100 );
+    p->vLits        = Vec_IntAlloc( 100 );
     p->vCex         = Vec_IntAlloc( 100 );
     p->vVisits      = Vec_IntAlloc( 100 );
     return p;
@@ -110,6 +112,8 @@ void Cec_ManSatStop( Cec_ManSat_t * p )
     Vec_IntFree( p->vVisits );
     Vec_PtrFree( p->vUsedNodes );
     Vec_PtrFree( p->vFanins );
+    Vec_PtrFree( p->vFrontier );
+    Vec_IntFree( p->vLits );
     ABC_FREE( p->pSatVars );
     ABC_FREE( p );
 }
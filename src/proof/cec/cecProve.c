@@ -51,14 +51,93 @@ extern int Bmcg_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars );
 
 #ifndef ABC_USE_PTHREADS
 
-int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3, int fShare, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
 
+#define PAR_THR_MAX 8
+#define PAR_RUN_MAX 16    // the max number of portfolios sharing results at the same time
+
+// partial results published by the engines running concurrently
+typedef struct Cec_ProveShare_t_ Cec_ProveShare_t;
+struct Cec_ProveShare_t_
+{
+    Gia_Man_t *      pMiter;                  // the smallest miter sequentially equivalent to the original one
+    int              iVersion;                // the number of times the miter was updated
+    int              pVersions[PAR_THR_MAX];  // the version of the miter used by each engine
+    int              nFramesSafe;             // the number of frames proved to have no failing outputs
+    int              nRegs;                   // the number of flops in the original miter
+    int              nPos;                    // the number of outputs in the original miter
+    int              RetValue;                // the verdict
+    int              RetEngine;               // the engine that reached the verdict
+    Abc_Cex_t *      pCex;                    // the counter-example for the original miter
+    abctime          clkStop;                 // the time to stop
+    pthread_mutex_t  Mutex;
+};
+
+// the portfolios currently running; an engine finds its portfolio by RunId = iRun * PAR_THR_MAX + iEngine
+static Cec_ProveShare_t * s_pProveShares[PAR_RUN_MAX] = { NULL };
+static pthread_mutex_t    s_ProveSharesMutex = PTHREAD_MUTEX_INITIALIZER;
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Callbacks used by the engines at the safe points.]
+
+  Description [An engine terminates when the verdict is known, or when
+  a smaller miter has been published since it started, in which case it
+  is restarted on the new miter. The BMC engine publishes the frames
+  without failing outputs, which the BMC engines started later skip.
+  The portfolio stays registered while its engines are running, so
+  the lookup by RunId does not need a lock.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Cec_ProveShare_t * Cec_GiaProveShareFromRunId( int RunId )
+{
+    assert( RunId >= 0 && RunId < PAR_RUN_MAX * PAR_THR_MAX );
+    assert( s_pProveShares[RunId / PAR_THR_MAX] != NULL );
+    return s_pProveShares[RunId / PAR_THR_MAX];
+}
+int Cec_GiaProveCallBackToStop( int RunId )
+{
+    Cec_ProveShare_t * p = Cec_GiaProveShareFromRunId( RunId );
+    return p->RetValue != -1 || p->pVersions[RunId % PAR_THR_MAX] < p->iVersion;
+}
+void Cec_GiaProveCallBackOnFrameDone( int RunId, int iFrame, int iPo, int Status )
+{
+    Cec_ProveShare_t * p = Cec_GiaProveShareFromRunId( RunId );
+    pthread_mutex_lock( &p->Mutex );
+    if ( Status == 0 && iPo == p->nPos - 1 )
+        p->nFramesSafe = Abc_MaxInt( p->nFramesSafe, iFrame + 1 );
+    pthread_mutex_unlock( &p->Mutex );
+}
+int Cec_GiaProveShareRegister( Cec_ProveShare_t * p )
+{
+    int i;
+    pthread_mutex_lock( &s_ProveSharesMutex );
+    for ( i = 0; i < PAR_RUN_MAX; i++ )
+        if ( s_pProveShares[i] == NULL )
+        {
+            s_pProveShares[i] = p;
+            break;
+        }
+    pthread_mutex_unlock( &s_ProveSharesMutex );
+    return i < PAR_RUN_MAX ? i : -1;
+}
+void Cec_GiaProveShareUnregister( int iRun )
+{
+    pthread_mutex_lock( &s_ProveSharesMutex );
+    s_pProveShares[iRun] = NULL;
+    pthread_mutex_unlock( &s_ProveSharesMutex );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -70,7 +149,7 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
   SeeAlso     []
 
 ***********************************************************************/
-int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
+int Cec_GiaProveOneInt( Gia_Man_t * p, int iEngine, int nTimeOut, int nStart, int RunId, int fVerbose )
 {
     abctime clk = Abc_Clock();   
     int RetValue = -1;
@@ -84,14 +163,19 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
         Ssw_RarSetDefaultParams( pPars );
         pPars->TimeOut = nTimeOut;
         pPars->fSilent = 1;
+        if ( RunId >= 0 )
+            pPars->pFuncStop = Cec_GiaProveCallBackToStop, pPars->RunId = RunId;
         RetValue = Ssw_RarSimulateGia( p, pPars );
     }
     else if ( iEngine == 1 )
     {
         Saig_ParBmc_t Pars, * pPars = &Pars;
         Saig_ParBmcSetDefaultParams( pPars );
+        pPars->nStart   = nStart;
         pPars->nTimeOut = nTimeOut;
         pPars->fSilent  = 1;
+        if ( RunId >= 0 )
+            pPars->pFuncStop = Cec_GiaProveCallBackToStop, pPars->RunId = RunId;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Saig_ManBmcScalable( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -103,6 +187,8 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
         Pdr_ManSetDefaultParams( pPars );
         pPars->nTimeOut = nTimeOut;
         pPars->fSilent  = 1;
+        if ( RunId >= 0 )
+            pPars->pFuncStop = Cec_GiaProveCallBackToStop, pPars->RunId = RunId;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Pdr_ManSolve( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -113,8 +199,11 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
         Saig_ParBmc_t Pars, * pPars = &Pars;
         Saig_ParBmcSetDefaultParams( pPars );
         pPars->fUseGlucose = 1;
+        pPars->nStart      = nStart;
         pPars->nTimeOut    = nTimeOut;
         pPars->fSilent     = 1;
+        if ( RunId >= 0 )
+            pPars->pFuncStop = Cec_GiaProveCallBackToStop, pPars->RunId = RunId;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Saig_ManBmcScalable( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -127,6 +216,8 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
         pPars->fUseAbs  = 1;
         pPars->nTimeOut = nTimeOut;
         pPars->fSilent  = 1;
+        if ( RunId >= 0 )
+            pPars->pFuncStop = Cec_GiaProveCallBackToStop, pPars->RunId = RunId;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Pdr_ManSolve( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -140,6 +231,12 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
         pPars->nFramesAdd    =        1;  // the number of additional frames
         pPars->fNotVerbose   =        1;  // silent
         pPars->nTimeOut      = nTimeOut;  // timeout in seconds
+        pPars->nStart        =   nStart;  // starting timeframe
+        if ( RunId >= 0 )
+        {
+            pPars->pFuncStop           = Cec_GiaProveCallBackToStop, pPars->RunId = RunId;
+            pPars->pFuncOnFrameDoneRun = Cec_GiaProveCallBackOnFrameDone;
+        }
         RetValue = Bmcg_ManPerform( p, pPars );
     }
     else assert( 0 );
@@ -150,6 +247,10 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
     }
     return RetValue;
 }
+int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
+{
+    return Cec_GiaProveOneInt( p, iEngine, nTimeOut, 0, -1, fVerbose );
+}
 Gia_Man_t * Cec_GiaScorrOld( Gia_Man_t * p )
 {
     Ssw_Pars_t Pars, * pPars = &Pars;
@@ -183,11 +284,12 @@ Gia_Man_t * Cec_GiaScorrNew( Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 8
 typedef struct Par_ThData_t_
 {
     Gia_Man_t * p;
+    Cec_ProveShare_t * pShare;
     int         iEngine;
+    int         RunId;
     int         fWorking;
     int         nTimeOut;
     int         Result;
@@ -220,7 +322,9 @@ void Cec_GiaInitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int n
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].p        = Gia_ManDup(p);
+        ThData[i].pShare   = NULL;
         ThData[i].iEngine  = i;
+        ThData[i].RunId    = -1;
         ThData[i].nTimeOut = nTimeOut;
         ThData[i].fWorking = 0;
         ThData[i].Result   = -1;
@@ -248,12 +352,159 @@ int Cec_GiaWaitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int Re
     }
     return RetValue;
 }
-    
-int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3, int fVerbose, int fVeryVerbose, int fSilent )
+
+
+/**Function*************************************************************
+
+  Synopsis    [Portfolio with sharing of the partial results.]
+
+  Description [The engines run until the verdict or the total timeout.
+  Meanwhile, the calling thread computes signal correspondence and
+  publishes the reduced miters, in which the proved equivalences and
+  constants are merged. The engines pick up the reduced miter at their
+  next safe point, and the BMC engines start after the last frame
+  proved by other BMC runs. Returns -2 if too many portfolios are
+  already running.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_GiaProveIsConst0( Gia_Man_t * p )
+{
+    int i;
+    for ( i = 0; i < Gia_ManPoNum(p); i++ )
+        if ( !Gia_ManPoIsConst0(p, i) )
+            return 0;
+    return 1;
+}
+int Cec_GiaProvePublish( Cec_ProveShare_t * p, Gia_Man_t * pNew, abctime clk, int fVerbose )
+{
+    int fUpdate;
+    pthread_mutex_lock( &p->Mutex );
+    fUpdate = p->RetValue == -1 && Gia_ManAndNum(pNew) < Gia_ManAndNum(p->pMiter);
+    if ( fUpdate )
+    {
+        if ( fVerbose ) {
+            printf( "Reduced the miter from %d to %d nodes. ", Gia_ManAndNum(p->pMiter), Gia_ManAndNum(pNew) );
+            Abc_PrintTime( 1, "Time", clk );
+        }
+        Gia_ManStop( p->pMiter );
+        p->pMiter = Gia_ManDup( pNew );
+        p->iVersion++;
+        if ( Cec_GiaProveIsConst0(pNew) )
+            p->RetValue = 1, p->RetEngine = -1;
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    return p->RetValue;
+}
+void * Cec_GiaProveShareWorkerThread( void * pArg )
+{
+    Par_ThData_t * pThData = (Par_ThData_t *)pArg;
+    Cec_ProveShare_t * p = pThData->pShare;
+    Gia_Man_t * pGia;
+    int RetValue, nStart, nTimeLeft, fRestart = 1;
+    while ( fRestart )
+    {
+        // get the latest miter
+        pthread_mutex_lock( &p->Mutex );
+        nTimeLeft = (int)((p->clkStop - Abc_Clock()) / CLOCKS_PER_SEC);
+        if ( p->RetValue != -1 || nTimeLeft <= 0 )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            break;
+        }
+        pGia   = Gia_ManDup( p->pMiter );
+        nStart = p->nFramesSafe;
+        p->pVersions[pThData->iEngine] = p->iVersion;
+        pthread_mutex_unlock( &p->Mutex );
+        RetValue = Cec_GiaProveOneInt( pGia, pThData->iEngine, nTimeLeft, nStart, pThData->RunId, pThData->fVerbose );
+        // publish the verdict
+        pthread_mutex_lock( &p->Mutex );
+        if ( RetValue != -1 && p->RetValue == -1 )
+        {
+            p->RetValue  = RetValue;
+            p->RetEngine = pThData->iEngine;
+            if ( pGia->pCexSeq )
+                p->pCex = Abc_CexDup( pGia->pCexSeq, p->nRegs );
+        }
+        fRestart = p->RetValue == -1 && p->pVersions[pThData->iEngine] < p->iVersion;
+        pthread_mutex_unlock( &p->Mutex );
+        Gia_ManStop( pGia );
+    }
+    return NULL;
+}
+int Cec_GiaProveShare( Gia_Man_t * p, int nProcs, int nTimeOut, int fVerbose, int * pRetEngine )
+{
+    abctime clkStart = Abc_Clock();
+    Cec_ProveShare_t Share, * pShare = &Share;
+    Par_ThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Gia_Man_t * pScorr, * pScorr2;
+    int i, status, RetValue, iRun;
+    assert( nProcs <= PAR_THR_MAX );
+    memset( pShare, 0, sizeof(Cec_ProveShare_t) );
+    iRun = Cec_GiaProveShareRegister( pShare );
+    if ( iRun == -1 )
+        return -2;
+    pShare->pMiter    = Gia_ManDup( p );
+    pShare->nRegs     = Gia_ManRegNum( p );
+    pShare->nPos      = Gia_ManPoNum( p );
+    pShare->RetValue  = -1;
+    pShare->RetEngine = -2;
+    pShare->clkStop   = clkStart + (abctime)nTimeOut * CLOCKS_PER_SEC;
+    pthread_mutex_init( &pShare->Mutex, NULL );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p        = NULL;
+        ThData[i].pShare   = pShare;
+        ThData[i].iEngine  = i;
+        ThData[i].RunId    = iRun * PAR_THR_MAX + i;
+        ThData[i].fVerbose = fVerbose;
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaProveShareWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // meanwhile, perform scorr and publish the reduced miters
+    pScorr = Cec_GiaScorrNew( p );
+    RetValue = Cec_GiaProvePublish( pShare, pScorr, Abc_Clock() - clkStart, fVerbose );
+    if ( RetValue == -1 && Gia_ManAndNum(pScorr) < 100000 )
+    {
+        abctime clk = Abc_Clock();
+        pScorr2 = Cec_GiaScorrOld( pScorr );
+        Cec_GiaProvePublish( pShare, pScorr2, Abc_Clock() - clk, fVerbose );
+        Gia_ManStop( pScorr2 );
+    }
+    Gia_ManStop( pScorr );
+    // wait for the engines
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    Cec_GiaProveShareUnregister( iRun );
+    pthread_mutex_destroy( &pShare->Mutex );
+    if ( fVerbose && pShare->nFramesSafe )
+        printf( "BMC engines proved that no output fails in %d frames.\n", pShare->nFramesSafe );
+    p->pCexSeq  = pShare->pCex;
+    *pRetEngine = pShare->RetEngine;
+    Gia_ManStop( pShare->pMiter );
+    return pShare->RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3, int fShare, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkScorr = 0, clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
     pthread_t WorkerThread[PAR_THR_MAX];
+    Gia_Man_t * pScorr;
     int i, RetValue = -1, RetEngine = -2;
     Abc_CexFreeP( &p->pCexComb );
     Abc_CexFreeP( &p->pCexSeq );        
@@ -264,10 +515,19 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
     fflush( stdout );
 
     assert( nProcs == 3 || nProcs == 5 );
+    if ( fShare )
+    {
+        RetValue = Cec_GiaProveShare( p, nProcs, nTimeOut + nTimeOut2 + nTimeOut3, fVerbose && !fSilent, &RetEngine );
+        if ( RetValue != -2 )
+            goto finish;
+        if ( !fSilent )
+            printf( "Too many portfolios are running. Running without sharing.\n" );
+        RetValue = -1;
+    }
     Cec_GiaInitThreads( ThData, nProcs, p, nTimeOut, fVerbose, WorkerThread );
 
     // meanwhile, perform scorr
-    Gia_Man_t * pScorr = Cec_GiaScorrNew( p );
+    pScorr = Cec_GiaScorrNew( p );
     clkScorr = Abc_Clock() - clkTotal;
     if ( Gia_ManAndNum(pScorr) == 0 )
         RetValue = 1, RetEngine = -1;
@@ -313,6 +573,7 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
         ThData[i].p = NULL;
         ThData[i].fWorking = 1;
     }
+finish:
     if ( !fSilent )
     {
         printf( "Problem \"%s\" is ", p->pSpec );
@@ -25,6 +25,16 @@
 #include "base/abc/abc.h"
 #include "map/if/if.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 #define USE_GLUCOSE2
 
 #ifdef USE_GLUCOSE2
@@ -95,9 +105,12 @@ struct Cec4_Man_t_
     sat_solver *     pSat;           // SAT solver
     Vec_Ptr_t *      vFrontier;      // CNF construction
     Vec_Ptr_t *      vFanins;        // CNF construction
+    Vec_Int_t *      vLits;          // CNF construction
     Vec_Int_t *      vCexMin;        // minimized CEX
     Vec_Int_t *      vClassUpdates;  // updated equiv classes
     Vec_Int_t *      vCexStamps;     // time stamps
+    Vec_Wrd_t *      vCexConfs;      // pattern bits conflicting with the new CEX
+    int              iCexStamp;      // the number of CEXes saved since the last resimulation
     Vec_Int_t *      vCands;
     Vec_Int_t *      vVisit;
     Vec_Int_t *      vPat;
@@ -114,11 +127,14 @@ struct Cec4_Man_t_
     Vec_Int_t *      vRefBins;
     int *            pTable;
     int              nTableSize;
+    int              nRefWords;      // the number of leading words changed since the last refinement
+    Vec_Str_t *      vSimDiffs;      // nodes whose simulation info differs from their representatives
     // statistics
     int              nItersSim;
     int              nItersSat;
     int              nAndNodes;
     int              nPatterns;
+    int              nPatsPacked;
     int              nSatSat;
     int              nSatUnsat;
     int              nSatUndec;
@@ -139,6 +155,7 @@ struct Cec4_Man_t_
     abctime          timeRefine;
     abctime          timeResimGlo;
     abctime          timeResimLoc;
+    abctime          timePar;
     abctime          timeStart;
 };
 
@@ -222,6 +239,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nProcs         =       1;    // the number of concurrent threads for SAT sweeping
     pPars->fBMiterInfo    =       0;    // printing BMiter information
 }
 
@@ -277,9 +295,11 @@ Cec4_Man_t * Cec4_ManCreate( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
     sat_solver_set_jftr( p->pSat, pPars->jType );
     p->vFrontier     = Vec_PtrAlloc( 1000 );
     p->vFanins       = Vec_PtrAlloc( 100 );
+    p->vLits         = Vec_IntAlloc( 100 );
     p->vCexMin       = Vec_IntAlloc( 100 );
     p->vClassUpdates = Vec_IntAlloc( 100 );
     p->vCexStamps    = Vec_IntStart( Gia_ManObjNum(pAig) );
+    p->vCexConfs     = Vec_WrdAlloc( 100 );
     p->vCands        = Vec_IntAlloc( 100 );
     p->vVisit        = Vec_IntAlloc( 100 );
     p->vPat          = Vec_IntAlloc( 100 );
@@ -304,7 +324,7 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     {
         abctime timeTotal = Abc_Clock() - p->timeStart;
         abctime timeSat   = p->timeSatSat0 + p->timeSatSat + p->timeSatUnsat0 + p->timeSatUnsat + p->timeSatUndec;
-        abctime timeOther = timeTotal - timeSat - p->timeSim - p->timeRefine - p->timeResimLoc - p->timeGenPats;// - p->timeResimGlo;
+        abctime timeOther = timeTotal - timeSat - p->timeSim - p->timeRefine - p->timeResimLoc - p->timeGenPats - p->timePar;// - p->timeResimGlo;
         ABC_PRTP( "SAT solving  ", timeSat,          timeTotal );
         ABC_PRTP( "  sat(easy)  ", p->timeSatSat0,   timeTotal );
         ABC_PRTP( "  sat        ", p->timeSatSat,    timeTotal );
@@ -317,6 +337,8 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
         ABC_PRTP( "Refinement   ", p->timeRefine,    timeTotal );
         ABC_PRTP( "Resim global ", p->timeResimGlo,  timeTotal );
         ABC_PRTP( "Resim local  ", p->timeResimLoc,  timeTotal );
+        if ( p->pPars->nProcs > 1 )
+        ABC_PRTP( "Parallel SAT ", p->timePar,       timeTotal );
         ABC_PRTP( "Other        ", timeOther,        timeTotal );
         ABC_PRTP( "TOTAL        ", timeTotal,        timeTotal );
         fflush( stdout );
@@ -332,9 +354,11 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Gia_ManStopP( &p->pNew );
     Vec_PtrFreeP( &p->vFrontier );
     Vec_PtrFreeP( &p->vFanins );
+    Vec_IntFreeP( &p->vLits );
     Vec_IntFreeP( &p->vCexMin );
     Vec_IntFreeP( &p->vClassUpdates );
     Vec_IntFreeP( &p->vCexStamps );
+    Vec_WrdFreeP( &p->vCexConfs );
     Vec_IntFreeP( &p->vCands );
     Vec_IntFreeP( &p->vVisit );
     Vec_IntFreeP( &p->vPat );
@@ -345,6 +369,7 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vRefClasses );
     Vec_IntFreeP( &p->vRefNodes );
     Vec_IntFreeP( &p->vRefBins );
+    Vec_StrFreeP( &p->vSimDiffs );
     ABC_FREE( p->pTable );
     ABC_FREE( p );
 }
@@ -485,7 +510,7 @@ void Cec4_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, sat_solver * pSat )
     RetValue = sat_solver_addclause( pSat, pLits, 3 );
     assert( RetValue );
 }
-void Cec4_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, sat_solver * pSat )
+void Cec4_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, sat_solver * pSat, Vec_Int_t * vLits )
 {
     int fPolarFlip = 0;
     Gia_Obj_t * pFanin;
@@ -494,7 +519,8 @@ void Cec4_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper,
     assert( Gia_ObjIsAnd( pNode ) );
     // create storage for literals
     nLits = Vec_PtrSize(vSuper) + 1;
-    pLits = ABC_ALLOC( int, nLits );
+    Vec_IntFill( vLits, nLits, 0 );
+    pLits = Vec_IntArray( vLits );
     // suppose AND-gate is A & B = C
     // add !A => !C   or   A + !C
     Vec_PtrForEachEntry( Gia_Obj_t *, vSuper, pFanin, i )
@@ -525,7 +551,6 @@ void Cec4_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper,
     }
     RetValue = sat_solver_addclause( pSat, pLits, nLits );
     assert( RetValue );
-    ABC_FREE( pLits );
 }
 
 /**Function*************************************************************
@@ -657,7 +682,7 @@ int Cec4_ObjGetCnfVar( Cec4_Man_t * p, int iObj )
             Cec4_CollectSuper( pNode, fUseMuxes, p->vFanins );
             Vec_PtrForEachEntry( Gia_Obj_t *, p->vFanins, pFanin, k )
                 Cec4_ObjAddToFrontier( p->pNew, Gia_Regular(pFanin), p->vFrontier, p->pSat );
-            Cec4_AddClausesSuper( p->pNew, pNode, p->vFanins, p->pSat );
+            Cec4_AddClausesSuper( p->pNew, pNode, p->vFanins, p->pSat, p->vLits );
         }
         assert( Vec_PtrSize(p->vFanins) > 1 );
     }
@@ -680,26 +705,34 @@ static inline word * Cec4_ObjSim( Gia_Man_t * p, int iObj )
 {
     return Vec_WrdEntryP( p->vSims, p->nSimWords * iObj );
 }
-static inline int Cec4_ObjSimEqual( Gia_Man_t * p, int iObj0, int iObj1 )
+static inline word * Cec4_ObjCare( Gia_Man_t * p, int iObj )
+{
+    return Vec_WrdEntryP( p->vSimsPi, p->nSimWords * Gia_ObjCioId(Gia_ManObj(p, iObj)) );
+}
+static inline int Cec4_ObjSimEqualWords( Gia_Man_t * p, int iObj0, int iObj1, int nWords )
 {
     int w;
     word * pSim0 = Cec4_ObjSim( p, iObj0 );
     word * pSim1 = Cec4_ObjSim( p, iObj1 );
     if ( (pSim0[0] & 1) == (pSim1[0] & 1) )
     {
-        for ( w = 0; w < p->nSimWords; w++ )
+        for ( w = 0; w < nWords; w++ )
             if ( pSim0[w] != pSim1[w] )
                 return 0;
         return 1;
     }
     else
     {
-        for ( w = 0; w < p->nSimWords; w++ )
+        for ( w = 0; w < nWords; w++ )
             if ( pSim0[w] != ~pSim1[w] )
                 return 0;
         return 1;
     }
 }
+static inline int Cec4_ObjSimEqual( Gia_Man_t * p, int iObj0, int iObj1 )
+{
+    return Cec4_ObjSimEqualWords( p, iObj0, iObj1, p->nSimWords );
+}
 int Cec4_ManSimHashKey( word * pSim, int nSims, int nTableSize )
 {
     static int s_Primes[16] = { 
@@ -716,13 +749,13 @@ int Cec4_ManSimHashKey( word * pSim, int nSims, int nTableSize )
     return (int)(uHash % nTableSize);
 
 }
-void Cec4_RefineOneClassIter( Gia_Man_t * p, int iRepr )
+void Cec4_RefineOneClassIter( Gia_Man_t * p, int iRepr, int nWords )
 {
     int iObj, iPrev = iRepr, iPrev2, iRepr2;
     assert( Gia_ObjRepr(p, iRepr) == GIA_VOID );
     assert( Gia_ObjNext(p, iRepr) > 0 );
     Gia_ClassForEachObj1( p, iRepr, iRepr2 )
-        if ( Cec4_ObjSimEqual(p, iRepr, iRepr2) )
+        if ( Cec4_ObjSimEqualWords(p, iRepr, iRepr2, nWords) )
             iPrev = iRepr2;
         else
             break;
@@ -735,7 +768,7 @@ void Cec4_RefineOneClassIter( Gia_Man_t * p, int iRepr )
     iPrev2 = iRepr2;
     for ( iObj = Gia_ObjNext(p, iRepr2); iObj > 0; iObj = Gia_ObjNext(p, iObj) )
     {
-        if ( Cec4_ObjSimEqual(p, iRepr, iObj) ) // remains with iRepr
+        if ( Cec4_ObjSimEqualWords(p, iRepr, iObj, nWords) ) // remains with iRepr
         {
             Gia_ObjSetNext( p, iPrev, iObj );
             iPrev = iObj;
@@ -751,7 +784,7 @@ void Cec4_RefineOneClassIter( Gia_Man_t * p, int iRepr )
     Gia_ObjSetNext( p, iPrev2, -1 );
     // refine incrementally
     if ( Gia_ObjNext(p, iRepr2) > 0 )
-        Cec4_RefineOneClassIter( p, iRepr2 );
+        Cec4_RefineOneClassIter( p, iRepr2, nWords );
 }
 void Cec4_RefineOneClass( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Int_t * vNodes )
 {
@@ -759,7 +792,7 @@ void Cec4_RefineOneClass( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Int_t * vNodes )
     Vec_IntClear( pMan->vRefBins );
     Vec_IntForEachEntryReverse( vNodes, iObj, k )
     {
-        int Key = Cec4_ManSimHashKey( Cec4_ObjSim(p, iObj), p->nSimWords, pMan->nTableSize );
+        int Key = Cec4_ManSimHashKey( Cec4_ObjSim(p, iObj), pMan->nRefWords, pMan->nTableSize );
         assert( Key >= 0 && Key < pMan->nTableSize );
         if ( pMan->pTable[Key] == -1 )
             Vec_IntPush( pMan->vRefBins, Key );
@@ -776,7 +809,7 @@ void Cec4_RefineOneClass( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Int_t * vNodes )
             continue;
         for ( iObj = p->pNexts[iRepr]; iObj > 0; iObj = p->pNexts[iObj] )
             p->pReprs[iObj].iRepr = iRepr;
-        Cec4_RefineOneClassIter( p, iRepr );
+        Cec4_RefineOneClassIter( p, iRepr, pMan->nRefWords );
     }
     Vec_IntClear( pMan->vRefBins );
 }
@@ -841,11 +874,12 @@ void Cec4_RefineInit( Gia_Man_t * p, Cec4_Man_t * pMan )
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Cec4_ObjSimSetInputBit( Gia_Man_t * p, int iObj, int Bit )
+static inline void Cec4_ObjSimSetInputBit( Gia_Man_t * p, int iObj, int iBit, int Bit )
 {
     word * pSim = Cec4_ObjSim( p, iObj );
-    if ( Abc_InfoHasBit( (unsigned*)pSim, p->iPatsPi ) != Bit )
-        Abc_InfoXorBit( (unsigned*)pSim, p->iPatsPi );
+    if ( Abc_InfoHasBit( (unsigned*)pSim, iBit ) != Bit )
+        Abc_InfoXorBit( (unsigned*)pSim, iBit );
+    Abc_InfoSetBit( (unsigned*)Cec4_ObjCare(p, iObj), iBit );
 }
 static inline int Cec4_ObjSimGetInputBit( Gia_Man_t * p, int iObj )
 {
@@ -873,7 +907,7 @@ static inline void Cec4_ObjSimCo( Gia_Man_t * p, int iObj )
         for ( w = 0; w < p->nSimWords; w++ )
             pSimCo[w] =  pSimDri[w];
 }
-static inline void Cec4_ObjSimAnd( Gia_Man_t * p, int iObj )
+static inline void Cec4_ObjSimAndRange( Gia_Man_t * p, int iObj, int wBeg, int wEnd )
 {
     int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
@@ -881,19 +915,19 @@ static inline void Cec4_ObjSimAnd( Gia_Man_t * p, int iObj )
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
     if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
+        for ( w = wBeg; w < wEnd; w++ )
             pSim[w] = ~pSim0[w] & ~pSim1[w];
     else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
+        for ( w = wBeg; w < wEnd; w++ )
             pSim[w] = ~pSim0[w] & pSim1[w];
     else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
+        for ( w = wBeg; w < wEnd; w++ )
             pSim[w] = pSim0[w] & ~pSim1[w];
     else
-        for ( w = 0; w < p->nSimWords; w++ )
+        for ( w = wBeg; w < wEnd; w++ )
             pSim[w] = pSim0[w] & pSim1[w];
 }
-static inline void Cec4_ObjSimXor( Gia_Man_t * p, int iObj )
+static inline void Cec4_ObjSimXorRange( Gia_Man_t * p, int iObj, int wBeg, int wEnd )
 {
     int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
@@ -901,12 +935,20 @@ static inline void Cec4_ObjSimXor( Gia_Man_t * p, int iObj )
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
     if ( Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
+        for ( w = wBeg; w < wEnd; w++ )
             pSim[w] = ~pSim0[w] ^ pSim1[w];
     else
-        for ( w = 0; w < p->nSimWords; w++ )
+        for ( w = wBeg; w < wEnd; w++ )
             pSim[w] =  pSim0[w] ^ pSim1[w];
 }
+static inline void Cec4_ObjSimAnd( Gia_Man_t * p, int iObj )
+{
+    Cec4_ObjSimAndRange( p, iObj, 0, p->nSimWords );
+}
+static inline void Cec4_ObjSimXor( Gia_Man_t * p, int iObj )
+{
+    Cec4_ObjSimXorRange( p, iObj, 0, p->nSimWords );
+}
 static inline void Cec4_ObjSimCi( Gia_Man_t * p, int iObj )
 {
     int w;
@@ -963,23 +1005,178 @@ int Cec4_ManSimulateCos( Gia_Man_t * p )
     }
     return 1;
 }
-void Cec4_ManSimulate( Gia_Man_t * p, Cec4_Man_t * pMan )
+typedef struct Cec4_SimThData_t_ Cec4_SimThData_t;
+struct Cec4_SimThData_t_
+{
+    Gia_Man_t *      p;              // user's AIG
+    int              nWords;         // the number of leading words to compare
+    char *           pDiffs;         // comparison results (or NULL when simulating)
+    int              Beg;            // the first word (or object) to process
+    int              End;            // the last word (or object) to process
+};
+void * Cec4_ManSimulateThread( void * pArg )
+{
+    Cec4_SimThData_t * pThData = (Cec4_SimThData_t *)pArg;
+    Gia_Man_t * p = pThData->p;
+    Gia_Obj_t * pObj; int i, iRepr;
+    if ( pThData->pDiffs == NULL ) // simulate the slice of words of all nodes
+    {
+        Gia_ManForEachAnd( p, pObj, i )
+            if ( Gia_ObjIsXor(pObj) )
+                Cec4_ObjSimXorRange( p, i, pThData->Beg, pThData->End );
+            else
+                Cec4_ObjSimAndRange( p, i, pThData->Beg, pThData->End );
+        return NULL;
+    }
+    // compare the nodes in the range with their representatives
+    for ( i = pThData->Beg; i < pThData->End; i++ )
+    {
+        pObj = Gia_ManObj( p, i );
+        iRepr = Gia_ObjRepr( p, i );
+        pThData->pDiffs[i] = Gia_ObjIsAnd(pObj) && iRepr != GIA_VOID && !Cec4_ObjSimEqualWords(p, iRepr, i, pThData->nWords);
+    }
+    return NULL;
+}
+void Cec4_ManSimulateRun( Cec4_SimThData_t * pThData, int nThreads )
+{
+    int i;
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[CEC_PAR_THR_MAX];
+    int status;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec4_ManSimulateThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+#else
+    for ( i = 0; i < nThreads; i++ )
+        Cec4_ManSimulateThread( (void *)(pThData + i) );
+#endif
+}
+int Cec4_ManSimulateThreads( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    // each thread simulates a slice of at least one cache line
+    int nWords = pMan->nRefWords;
+    int nThreads = Abc_MinInt( Abc_MinInt(pMan->pPars->nProcs, CEC_PAR_THR_MAX), nWords / 8 );
+    Cec4_SimThData_t ThData[CEC_PAR_THR_MAX];
+    Gia_Obj_t * pObj; int i, iRepr;
+    if ( nThreads < 2 )
+        return 0;
+    // simulate the slices of words
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p      = p;
+        ThData[i].nWords = nWords;
+        ThData[i].pDiffs = NULL;
+        ThData[i].Beg    = i * nWords / nThreads;
+        ThData[i].End    = (i + 1) * nWords / nThreads;
+    }
+    Cec4_ManSimulateRun( ThData, nThreads );
+    // compare the ranges of objects after all slices are ready
+    if ( pMan->vSimDiffs == NULL )
+        pMan->vSimDiffs = Vec_StrAlloc( Gia_ManObjNum(p) );
+    Vec_StrFill( pMan->vSimDiffs, Gia_ManObjNum(p), 0 );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pDiffs = Vec_StrArray( pMan->vSimDiffs );
+        ThData[i].Beg    = i * Gia_ManObjNum(p) / nThreads;
+        ThData[i].End    = (i + 1) * Gia_ManObjNum(p) / nThreads;
+    }
+    Cec4_ManSimulateRun( ThData, nThreads );
+    // collect the classes to refine in the same order as the sequential simulation
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( !Vec_StrEntry(pMan->vSimDiffs, i) || p->pReprs[iRepr = Gia_ObjRepr(p, i)].fColorA )
+            continue;
+        p->pReprs[iRepr].fColorA = 1;
+        Vec_IntPush( pMan->vRefClasses, iRepr );
+    }
+    return 1;
+}
+// simulates and refines using the first nWords words; the caller guarantees that
+// the remaining words did not change since the last refinement, so that the members
+// of each class still agree there and only the changed classes are re-bucketed
+void Cec4_ManSimulateWords( Gia_Man_t * p, Cec4_Man_t * pMan, int nWords )
 {
     abctime clk = Abc_Clock();
     Gia_Obj_t * pObj; int i;
     pMan->nSimulates++;
     if ( pMan->pTable == NULL )
+    {
         Cec4_RefineInit( p, pMan );
+        nWords = p->nSimWords;
+    }
     else
         assert( Vec_IntSize(pMan->vRefClasses) == 0 );
-    Gia_ManForEachAnd( p, pObj, i )
+    assert( nWords > 0 && nWords <= p->nSimWords );
+    pMan->nRefWords = nWords;
+    if ( Cec4_ManSimulateThreads(p, pMan) )
+    {
+        // the slices are simulated and compared by the threads
+    }
+    else Gia_ManForEachAnd( p, pObj, i )
     {
         int iRepr = Gia_ObjRepr( p, i );
         if ( Gia_ObjIsXor(pObj) )
-            Cec4_ObjSimXor( p, i );
+            Cec4_ObjSimXorRange( p, i, 0, nWords );
         else
-            Cec4_ObjSimAnd( p, i );
-        if ( iRepr == GIA_VOID || p->pReprs[iRepr].fColorA || Cec4_ObjSimEqual(p, iRepr, i) )
+            Cec4_ObjSimAndRange( p, i, 0, nWords );
+        if ( iRepr == GIA_VOID || p->pReprs[iRepr].fColorA || Cec4_ObjSimEqualWords(p, iRepr, i, nWords) )
+            continue;
+        p->pReprs[iRepr].fColorA = 1;
+        Vec_IntPush( pMan->vRefClasses, iRepr );
+    }
+    pMan->timeSim += Abc_Clock() - clk;
+    clk = Abc_Clock();
+    Cec4_RefineClasses( p, pMan, pMan->vRefClasses );
+    pMan->timeRefine += Abc_Clock() - clk;
+}
+void Cec4_ManSimulate( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    Cec4_ManSimulateWords( p, pMan, p->nSimWords );
+}
+// same as above, when the CI patterns changed only where the care info in p->vSimsPi is set;
+// unless the fanout of the changed CIs is large, only the nodes in it are resimulated and 
+// only the classes where these nodes or their representatives belong are compared
+void Cec4_ManSimulateTfo( Gia_Man_t * p, Cec4_Man_t * pMan, int nWords )
+{
+    abctime clk = Abc_Clock();
+    Gia_Obj_t * pObj; int i, iRepr, fTfo, nTfo = 0;
+    if ( pMan->pTable == NULL )
+    {
+        Cec4_ManSimulateWords( p, pMan, nWords );
+        return;
+    }
+    Gia_ManIncrementTravId( p );
+    Gia_ManForEachCi( p, pObj, i )
+        if ( !Abc_TtIsConst0(Vec_WrdEntryP(p->vSimsPi, p->nSimWords * i), nWords) )
+            Gia_ObjSetTravIdCurrent( p, pObj );
+    Gia_ManForEachAnd( p, pObj, i )
+        if ( Gia_ObjIsTravIdCurrent(p, Gia_ObjFanin0(pObj)) || Gia_ObjIsTravIdCurrent(p, Gia_ObjFanin1(pObj)) )
+            Gia_ObjSetTravIdCurrent( p, pObj ), nTfo++;
+    if ( 2 * nTfo > Gia_ManAndNum(p) )
+    {
+        Cec4_ManSimulateWords( p, pMan, nWords );
+        return;
+    }
+    assert( Vec_IntSize(pMan->vRefClasses) == 0 );
+    assert( nWords > 0 && nWords <= p->nSimWords );
+    pMan->nSimulates++;
+    pMan->nRefWords = nWords;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( (fTfo = Gia_ObjIsTravIdCurrent(p, pObj)) )
+        {
+            if ( Gia_ObjIsXor(pObj) )
+                Cec4_ObjSimXorRange( p, i, 0, nWords );
+            else
+                Cec4_ObjSimAndRange( p, i, 0, nWords );
+        }
+        iRepr = Gia_ObjRepr( p, i );
+        if ( iRepr == GIA_VOID || p->pReprs[iRepr].fColorA || (!fTfo && !Gia_ObjIsTravIdCurrentId(p, iRepr)) )
+            continue;
+        if ( Cec4_ObjSimEqualWords(p, iRepr, i, nWords) )
             continue;
         p->pReprs[iRepr].fColorA = 1;
         Vec_IntPush( pMan->vRefClasses, iRepr );
@@ -992,19 +1189,20 @@ void Cec4_ManSimulate( Gia_Man_t * p, Cec4_Man_t * pMan )
 void Cec4_ManSimulate_rec( Gia_Man_t * p, Cec4_Man_t * pMan, int iObj )
 {
     Gia_Obj_t * pObj; 
-    if ( !iObj || Vec_IntEntry(pMan->vCexStamps, iObj) == p->iPatsPi )
+    if ( !iObj || Vec_IntEntry(pMan->vCexStamps, iObj) == pMan->iCexStamp )
         return;
-    Vec_IntWriteEntry( pMan->vCexStamps, iObj, p->iPatsPi );
+    Vec_IntWriteEntry( pMan->vCexStamps, iObj, pMan->iCexStamp );
     pObj = Gia_ManObj(p, iObj);
     if ( Gia_ObjIsCi(pObj) )
         return;
     assert( Gia_ObjIsAnd(pObj) );
     Cec4_ManSimulate_rec( p, pMan, Gia_ObjFaninId0(pObj, iObj) );
     Cec4_ManSimulate_rec( p, pMan, Gia_ObjFaninId1(pObj, iObj) );
+    // the words following the current patterns did not change since the last resimulation
     if ( Gia_ObjIsXor(pObj) )
-        Cec4_ObjSimXor( p, iObj );
+        Cec4_ObjSimXorRange( p, iObj, 0, Abc_Bit6WordNum(p->iPatsPi + 1) );
     else
-        Cec4_ObjSimAnd( p, iObj );
+        Cec4_ObjSimAndRange( p, iObj, 0, Abc_Bit6WordNum(p->iPatsPi + 1) );
 }
 void Cec4_ManSimAlloc( Gia_Man_t * p, int nWords )
 {
@@ -1642,6 +1840,81 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     //    printf( "*  " );
     return status;
 }
+// returns the first pattern compatible with the CEX, or 0 if there is none;
+// the conflicts with all patterns are derived at once using the care info
+int Cec4_ManPackFindPattern( Cec4_Man_t * p, Vec_Int_t * vPat )
+{
+    Gia_Man_t * pAig = p->pAig;
+    int i, w, iLit, nWords = Abc_Bit6WordNum( pAig->iPatsPi + 1 );
+    word * pConfs;
+    if ( pAig->iPatsPi == 0 )
+        return 0;
+    Vec_WrdFill( p->vCexConfs, nWords, 0 );
+    pConfs = Vec_WrdArray( p->vCexConfs );
+    pConfs[0] = 1; // the first pattern is reserved
+    Vec_IntForEachEntry( vPat, iLit, i )
+    {
+        word * pSim, * pCare, Value;
+        if ( !Gia_ObjIsCi(Gia_ManObj(pAig, Abc_Lit2Var(iLit))) )
+            continue;
+        pSim  = Cec4_ObjSim( pAig, Abc_Lit2Var(iLit) );
+        pCare = Cec4_ObjCare( pAig, Abc_Lit2Var(iLit) );
+        Value = Abc_LitIsCompl(iLit) ? 0 : ~(word)0;
+        for ( w = 0; w < nWords; w++ )
+            pConfs[w] |= pCare[w] & (pSim[w] ^ Value);
+    }
+    for ( w = 0; w < nWords; w++ )
+        if ( ~pConfs[w] )
+        {
+            int iPat = 64 * w + Abc_Tt6FirstBit( ~pConfs[w] );
+            return iPat <= pAig->iPatsPi ? iPat : 0;
+        }
+    return 0;
+}
+void Cec4_ManSaveCex( Cec4_Man_t * p, Vec_Int_t * vPat )
+{
+    int i, iLit, iPat;
+    assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
+    // add the CEX to an earlier pattern if they agree on the shared CIs
+    if ( (iPat = Cec4_ManPackFindPattern(p, vPat)) )
+        p->nPatsPacked++;
+    else
+        iPat = ++p->pAig->iPatsPi;
+    // the values of internal nodes in the CEX (if any) are derived by simulation
+    Vec_IntForEachEntry( vPat, iLit, i )
+        if ( Gia_ObjIsCi(Gia_ManObj(p->pAig, Abc_Lit2Var(iLit))) )
+            Cec4_ObjSimSetInputBit( p->pAig, Abc_Lit2Var(iLit), iPat, Abc_LitIsCompl(iLit) );
+    p->iCexStamp++;
+    if ( p->pAig->vPats )
+    {
+        Vec_IntPush( p->pAig->vPats, Vec_IntSize(vPat)+2 );
+        Vec_IntAppend( p->pAig->vPats, vPat );
+        Vec_IntPush( p->pAig->vPats, -1 );
+    }
+    // resimulated once in a while
+    if ( p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 2 )
+    {
+        abctime clk2 = Abc_Clock();
+        Cec4_ManSimulateTfo( p->pAig, p, p->pAig->nSimWords );
+        //printf( "FasterSmall = %d.  FasterBig = %d.\n", p->nFaster[0], p->nFaster[1] );
+        p->nFaster[0] = p->nFaster[1] = 0;
+        //if ( p->nSatSat && p->nSatSat % 100 == 0 )
+            Cec4_ManPrintStats( p->pAig, p->pPars, p, 0 );
+        Vec_IntFill( p->vCexStamps, Gia_ManObjNum(p->pAig), 0 );
+        p->iCexStamp = 0;
+        p->pAig->iPatsPi = 0;
+        Vec_WrdFill( p->pAig->vSimsPi, Vec_WrdSize(p->pAig->vSimsPi), 0 );
+        p->timeResimGlo += Abc_Clock() - clk2;
+    }
+}
+// marks the node as proved and records the class member it was proved against (if requested)
+static inline void Cec4_ManSetProved( Cec4_Man_t * p, int iObj, int iRepr )
+{
+    Gia_Man_t * pAig = p->pAig;
+    Gia_ObjSetProved( pAig, iObj );
+    if ( pAig->vProved )
+        Vec_IntPushTwo( pAig->vProved, iObj, Abc_Var2Lit(iRepr, Gia_ManObj(pAig, iObj)->fPhase ^ Gia_ManObj(pAig, iRepr)->fPhase) );
+}
 int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
 {
     abctime clk = Abc_Clock();
@@ -1653,7 +1926,6 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
     status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose, fEffort );
     if ( status == GLUCOSE_SAT )
     {
-        int iLit;
         //int iPatsOld = p->pAig->iPatsPi;
         //printf( "Disproved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatSat++;
@@ -1671,16 +1943,6 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
             for ( i = 0; i < pCex[0]; )
                 Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
         }
-        assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
-        p->pAig->iPatsPi++;
-        Vec_IntForEachEntry( p->vPat, iLit, i )
-            Cec4_ObjSimSetInputBit( p->pAig, Abc_Lit2Var(iLit), Abc_LitIsCompl(iLit) );
-        if ( p->pAig->vPats )
-        {
-            Vec_IntPush( p->pAig->vPats, Vec_IntSize(p->vPat)+2 );
-            Vec_IntAppend( p->pAig->vPats, p->vPat );
-            Vec_IntPush( p->pAig->vPats, -1 );
-        }
         //Cec4_ManPackAddPattern( p->pAig, p->vPat, 0 );
         //assert( iPatsOld + 1 == p->pAig->iPatsPi );
         if ( fEasy )
@@ -1690,27 +1952,14 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
         RetValue = 0;
         // this is not needed, but we keep it here anyway, because it takes very little time
         //Cec4_ManVerify( p->pNew, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, p->pSat );
-        // resimulated once in a while
-        if ( p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 2 )
-        {
-            abctime clk2 = Abc_Clock();
-            Cec4_ManSimulate( p->pAig, p );
-            //printf( "FasterSmall = %d.  FasterBig = %d.\n", p->nFaster[0], p->nFaster[1] );
-            p->nFaster[0] = p->nFaster[1] = 0;
-            //if ( p->nSatSat && p->nSatSat % 100 == 0 )
-                Cec4_ManPrintStats( p->pAig, p->pPars, p, 0 );
-            Vec_IntFill( p->vCexStamps, Gia_ManObjNum(p->pAig), 0 );
-            p->pAig->iPatsPi = 0;
-            Vec_WrdFill( p->pAig->vSimsPi, Vec_WrdSize(p->pAig->vSimsPi), 0 );
-            p->timeResimGlo += Abc_Clock() - clk2;
-        }
+        Cec4_ManSaveCex( p, p->vPat );
     }
     else if ( status == GLUCOSE_UNSAT )
     {
         //printf( "Proved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatUnsat++;
         pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
-        Gia_ObjSetProved( p->pAig, iObj );
+        Cec4_ManSetProved( p, iObj, iRepr );
         if ( iRepr == 0 )
             p->iLastConst = iObj;
         if ( fEasy )
@@ -1727,7 +1976,7 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
         {
             Vec_IntPushTwo( p->vPairs, Abc_Var2Lit(iRepr, 0), Abc_Var2Lit(iObj, fCompl) );
             p->timeSatUndec += Abc_Clock() - clk;
-            // mark as proved
+            // mark as proved (but do not record, because it was not proved)
             pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
             Gia_ObjSetProved( p->pAig, iObj );
             if ( iRepr == 0 )
@@ -1825,9 +2074,10 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
         printf( "Cannot open file \"%s\" for writing primary output information.\n", pMan->pPars->pDumpName );
         return;
     }
-    vSimsPi = Vec_WrdDup( pMan->pAig->vSimsPi );
-    memmove( Vec_WrdArray(vSimsPi), Vec_WrdArray(vSimsPi) + nWords, Gia_ManCiNum(pMan->pAig) * nWords );
-    Vec_WrdShrink( vSimsPi, Gia_ManCiNum(pMan->pAig) * nWords );
+    // the CI patterns are stored in the simulation info of the CIs (pMan->pAig->vSimsPi holds the care bits)
+    vSimsPi = Vec_WrdStart( Gia_ManCiNum(pMan->pAig) * nWords );
+    Gia_ManForEachCi( pMan->pAig, pObj, i )
+        memcpy( Vec_WrdEntryP(vSimsPi, nWords*i), Cec4_ObjSim(pMan->pAig, Gia_ObjId(pMan->pAig, pObj)), sizeof(word) * nWords );
     if ( Abc_TtIsConst0(Vec_WrdArray(vSimsPi), Gia_ManCiNum(pMan->pAig) * nWords) ) {
         Vec_WrdFree( vSimsPi );
         vSimsPi = Vec_WrdStartRandom( Gia_ManCiNum(pMan->pAig) * nWords );
@@ -1858,12 +2108,421 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
     Vec_WrdFree( vSims );
     Vec_WrdFree( vSimsPi );
 }
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping.]
+
+  Description [The AND nodes are swept in waves. A node is placed into 
+  the wave following those of its fanins and of the members of its class
+  with smaller IDs, so the nodes of one wave do not depend on each other
+  and their candidate pairs can be solved concurrently on the internal 
+  AIG, which is not modified while the threads are running. Each thread owns a SAT solver and a private 
+  mapping of AIG objects into SAT variables. The results are applied 
+  by the calling thread in the order of nodes, the same way as it is 
+  done by Cec4_ManSweepNode() in the sequential sweeping.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec4_ParMan_t_ Cec4_ParMan_t;
+typedef struct Cec4_ParThData_t_ Cec4_ParThData_t;
+struct Cec4_ParThData_t_
+{
+    Cec4_ParMan_t *  pPar;           // parallel manager
+    sat_solver *     pSat;           // SAT solver of this thread
+    Vec_Int_t *      vSatIds;        // mapping of AIG objects into SAT variables
+    Vec_Int_t *      vSuppVars;      // AIG objects having SAT variables
+    Vec_Int_t *      vCiVars;        // pairs (CiAigId, SatId)
+    Vec_Int_t *      vVarMap;        // mapping of SAT variables into AIG objects
+    int              nCallsSince;    // the number of calls since the last recycling
+};
+struct Cec4_ParMan_t_
+{
+    Cec4_Man_t *     pMan;           // sweeping manager
+    Vec_Int_t *      vPairs;         // candidate pairs (iRepr, iObj) of the user's AIG
+    Vec_Int_t *      vQueries;       // SAT queries (iObj0, iObj1, fCompl, nBTLimit) of the internal AIG
+    Vec_Int_t *      vStatus;        // solver status for each pair
+    Vec_Int_t *      vConfs;         // the number of conflicts for each pair
+    Vec_Wrd_t *      vTimes;         // the runtime for each pair
+    Vec_Wec_t *      vCexes;         // counter-example for each pair
+    int              iNext;          // the next pair to be solved
+    int              nProcs;         // the number of threads
+    Cec4_ParThData_t ThData[CEC_PAR_THR_MAX];
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;          // protects the next pair
+#endif
+};
+
+static inline int Cec4_ParObjSatId( Cec4_ParThData_t * p, int iObj )               { return Vec_IntEntry(p->vSatIds, iObj);                                                              }
+static inline int Cec4_ParObjSetSatId( Cec4_ParThData_t * p, int iObj, int Num )   { assert(Cec4_ParObjSatId(p, iObj) == -1); Vec_IntWriteEntry(p->vSatIds, iObj, Num); Vec_IntPush(p->vSuppVars, iObj); assert(Vec_IntSize(p->vVarMap) == Num); Vec_IntPush(p->vVarMap, iObj); return Num; }
+
+Cec4_ParMan_t * Cec4_ParManStart( Cec4_Man_t * pMan, int nProcs )
+{
+    Cec4_ParMan_t * p = ABC_CALLOC( Cec4_ParMan_t, 1 );
+    int i;
+    assert( nProcs >= 1 && nProcs <= CEC_PAR_THR_MAX );
+    p->pMan     = pMan;
+    p->nProcs   = nProcs;
+    p->vPairs   = Vec_IntAlloc( 1000 );
+    p->vQueries = Vec_IntAlloc( 1000 );
+    p->vStatus  = Vec_IntAlloc( 1000 );
+    p->vConfs   = Vec_IntAlloc( 1000 );
+    p->vTimes   = Vec_WrdAlloc( 1000 );
+    p->vCexes   = Vec_WecAlloc( 1000 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        p->ThData[i].pPar      = p;
+        p->ThData[i].pSat      = sat_solver_start();
+        p->ThData[i].vSatIds   = Vec_IntAlloc( 1000 );
+        p->ThData[i].vSuppVars = Vec_IntAlloc( 1000 );
+        p->ThData[i].vCiVars   = Vec_IntAlloc( 1000 );
+        p->ThData[i].vVarMap   = Vec_IntAlloc( 1000 );
+        sat_solver_set_jftr( p->ThData[i].pSat, pMan->pPars->jType );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    return p;
+}
+void Cec4_ParManStop( Cec4_ParMan_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        p->pMan->nRecycles += p->ThData[i].nCallsSince > 0;
+        sat_solver_stop( p->ThData[i].pSat );
+        Vec_IntFree( p->ThData[i].vSatIds );
+        Vec_IntFree( p->ThData[i].vSuppVars );
+        Vec_IntFree( p->ThData[i].vCiVars );
+        Vec_IntFree( p->ThData[i].vVarMap );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    Vec_IntFree( p->vPairs );
+    Vec_IntFree( p->vQueries );
+    Vec_IntFree( p->vStatus );
+    Vec_IntFree( p->vConfs );
+    Vec_WrdFree( p->vTimes );
+    Vec_WecFree( p->vCexes );
+    ABC_FREE( p );
+}
+void Cec4_ParSatSolverRecycle( Cec4_ParThData_t * p )
+{
+    int i, iObj;
+    p->nCallsSince = 0;
+    sat_solver_reset( p->pSat );
+    Vec_IntForEachEntry( p->vSuppVars, iObj, i )
+        Vec_IntWriteEntry( p->vSatIds, iObj, -1 );
+    Vec_IntClear( p->vSuppVars );
+    Vec_IntClear( p->vCiVars );
+    Vec_IntClear( p->vVarMap );
+}
+int Cec4_ParObjGetCnfVar_rec( Cec4_ParThData_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pPar->pMan->pNew, iObj );
+    int iVar, iVar0, iVar1;
+    if ( Cec4_ParObjSatId(p, iObj) >= 0 )
+        return Cec4_ParObjSatId(p, iObj);
+    if ( iObj == 0 )
+    {
+        int Lit = Abc_Var2Lit( Cec4_ParObjSetSatId(p, iObj, sat_solver_addvar(p->pSat)), 1 );
+        sat_solver_addclause( p->pSat, &Lit, 1 );
+        return Abc_Lit2Var( Lit );
+    }
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        iVar = Cec4_ParObjSetSatId( p, iObj, sat_solver_addvar(p->pSat) );
+        Vec_IntPushTwo( p->vCiVars, iObj, iVar );
+        return iVar;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    iVar0 = Cec4_ParObjGetCnfVar_rec( p, Gia_ObjFaninId0(pObj, iObj) );
+    iVar1 = Cec4_ParObjGetCnfVar_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+    iVar  = Cec4_ParObjSetSatId( p, iObj, sat_solver_addvar(p->pSat) );
+    if ( p->pPar->pMan->pPars->jType < 2 )
+    {
+        if ( Gia_ObjIsXor(pObj) )
+            sat_solver_add_xor( p->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) );
+        else
+            sat_solver_add_and( p->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0 );
+    }
+    if ( p->pPar->pMan->pPars->jType > 0 )
+    {
+        int Lit0 = Abc_Var2Lit( iVar0, Gia_ObjFaninC0(pObj) );
+        int Lit1 = Abc_Var2Lit( iVar1, Gia_ObjFaninC1(pObj) );
+        if ( (Lit0 > Lit1) ^ Gia_ObjIsXor(pObj) )
+             Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+        sat_solver_set_var_fanin_lit( p->pSat, iVar, Lit0, Lit1 );
+    }
+    return iVar;
+}
+int Cec4_ParSolveTwo( Cec4_ParThData_t * p, int iObj0, int iObj1, int fPhase, int nBTLimit, Vec_Int_t * vCex, int * pnConfs )
+{
+    Cec_ParFra_t * pPars = p->pPar->pMan->pPars;
+    int i, IdAig, IdSat, iVar0, iVar1, Lits[2], status, nConfBeg;
+    if ( iObj1 <  iObj0 ) 
+         iObj1 ^= iObj0, iObj0 ^= iObj1, iObj1 ^= iObj0;
+    assert( iObj0 < iObj1 );
+    if ( ++p->nCallsSince > pPars->nCallsRecycle && 
+         Vec_IntSize(p->vSuppVars) > pPars->nSatVarMax && pPars->nSatVarMax )
+        Cec4_ParSatSolverRecycle( p );
+    iVar0 = Cec4_ParObjGetCnfVar_rec( p, iObj0 );
+    iVar1 = Cec4_ParObjGetCnfVar_rec( p, iObj1 );
+    if ( pPars->jType > 0 )
+    {
+        sat_solver_start_new_round( p->pSat );
+        sat_solver_mark_cone( p->pSat, iVar0 );
+        sat_solver_mark_cone( p->pSat, iVar1 );
+    }
+    Lits[0] = Abc_Var2Lit( iVar0, 1 );
+    Lits[1] = Abc_Var2Lit( iVar1, fPhase );
+    sat_solver_set_conflict_budget( p->pSat, nBTLimit );
+    nConfBeg = sat_solver_conflictnum( p->pSat );
+    status = sat_solver_solve( p->pSat, Lits, 2 );
+    if ( status == GLUCOSE_UNSAT && iObj0 > 0 )
+    {
+        Lits[0] = Abc_Var2Lit( iVar0, 0 );
+        Lits[1] = Abc_Var2Lit( iVar1, !fPhase );
+        sat_solver_set_conflict_budget( p->pSat, nBTLimit );
+        status = sat_solver_solve( p->pSat, Lits, 2 );
+    }
+    *pnConfs = sat_solver_conflictnum( p->pSat ) - nConfBeg;
+    Vec_IntClear( vCex );
+    if ( status == GLUCOSE_SAT && pPars->jType == 0 )
+    {
+        Vec_IntForEachEntryDouble( p->vCiVars, IdAig, IdSat, i )
+            Vec_IntPush( vCex, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
+    }
+    else if ( status == GLUCOSE_SAT )
+    {
+        int * pCex = sat_solver_read_cex( p->pSat );
+        int * pMap = Vec_IntArray( p->vVarMap );
+        for ( i = 0; i < pCex[0]; )
+            Vec_IntPush( vCex, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
+    }
+    return status;
+}
+int Cec4_ParManNextPair( Cec4_ParMan_t * p )
+{
+    int iPair;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    iPair = p->iNext < Vec_IntSize(p->vStatus) ? p->iNext++ : -1;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    return iPair;
+}
+void * Cec4_ParWorkerThread( void * pArg )
+{
+    Cec4_ParThData_t * pThData = (Cec4_ParThData_t *)pArg;
+    Cec4_ParMan_t * p = pThData->pPar;
+    int iPair, * pQuery;
+    while ( (iPair = Cec4_ParManNextPair(p)) >= 0 )
+    {
+        abctime clk = Abc_Clock();
+        pQuery = Vec_IntEntryP( p->vQueries, 4*iPair );
+        Vec_IntWriteEntry( p->vStatus, iPair, Cec4_ParSolveTwo(pThData, pQuery[0], pQuery[1], pQuery[2], pQuery[3], Vec_WecEntry(p->vCexes, iPair), Vec_IntEntryP(p->vConfs, iPair)) );
+        Vec_WrdWriteEntry( p->vTimes, iPair, (word)(Abc_Clock() - clk) );
+    }
+    return NULL;
+}
+void Cec4_ParManSolveBatch( Cec4_ParMan_t * p )
+{
+    int i, nPairs = Vec_IntSize(p->vPairs)/2;
+    int nThreads = Abc_MinInt( p->nProcs, nPairs );
+    p->iNext = 0;
+    Vec_IntFill( p->vStatus, nPairs, GLUCOSE_UNDEC );
+    Vec_IntFill( p->vConfs, nPairs, 0 );
+    Vec_WrdFill( p->vTimes, nPairs, 0 );
+    if ( Vec_WecSize(p->vCexes) < nPairs )
+        Vec_WecInit( p->vCexes, nPairs );
+    // extend the mapping to the nodes added to the internal AIG
+    for ( i = 0; i < nThreads; i++ )
+        Vec_IntFillExtra( p->ThData[i].vSatIds, Gia_ManObjNum(p->pMan->pNew), -1 );
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[CEC_PAR_THR_MAX];
+        int status;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Cec4_ParWorkerThread, (void *)(p->ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+            pthread_join( WorkerThread[i], NULL );
+        return;
+    }
+#endif
+    for ( i = 0; i < nThreads; i++ )
+        Cec4_ParWorkerThread( (void *)(p->ThData + i) );
+}
+void Cec4_ManSweepLevels( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    Cec_ParFra_t * pPars = pMan->pPars;
+    Cec4_ParMan_t * pPar = Cec4_ParManStart( pMan, pPars->nProcs );
+    Vec_Int_t * vWaves = Vec_IntStart( Gia_ManObjNum(p) );
+    Vec_Int_t * vClassWaves = Vec_IntStart( Gia_ManObjNum(p) );
+    Vec_Wec_t * vNodes = Vec_WecAlloc( 100 );
+    Vec_Int_t * vLevel;
+    Gia_Obj_t * pObj, * pRepr;
+    int i, k, Wave, iRepr, iObj, status, nConfs, fCompl;
+    abctime Time;
+    // assign the waves
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Wave = 1 + Abc_MaxInt( Vec_IntEntry(vWaves, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vWaves, Gia_ObjFaninId1(pObj, i)) );
+        if ( (iRepr = Gia_ObjRepr(p, i)) != GIA_VOID && iRepr > 0 )
+        {
+            Wave = Abc_MaxInt( Wave, 1 + Vec_IntEntry(vClassWaves, iRepr) );
+            Vec_IntWriteEntry( vClassWaves, iRepr, Wave );
+        }
+        Vec_IntWriteEntry( vWaves, i, Wave );
+        if ( Gia_ObjIsHead(p, i) )
+            Vec_IntWriteEntry( vClassWaves, i, Wave );
+        Vec_WecPush( vNodes, Wave, i );
+    }
+    Vec_WecForEachLevel( vNodes, vLevel, k )
+    {
+        abctime clk = Abc_Clock();
+        // add the nodes of this wave to the internal AIG and collect candidate pairs
+        Vec_IntClear( pPar->vPairs );
+        Vec_IntClear( pPar->vQueries );
+        Gia_ManForEachObjVec( vLevel, p, pObj, i )
+        {
+            Gia_Obj_t * pObjNew; int fCompl, fEffort, iObjNew0, iObjNew1;
+            pMan->nAndNodes++;
+            if ( Gia_ObjIsXor(pObj) )
+                pObj->Value = Gia_ManHashXorReal( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            else
+                pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            if ( pPars->nLevelMax && Gia_ObjLevel(p, pObj) > pPars->nLevelMax )
+                continue;
+            pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
+            if ( Gia_ObjIsAnd(pObjNew) )
+            if ( Vec_BitEntry(pMan->vFails, Gia_ObjFaninId0(pObjNew, Abc_Lit2Var(pObj->Value))) || 
+                 Vec_BitEntry(pMan->vFails, Gia_ObjFaninId1(pObjNew, Abc_Lit2Var(pObj->Value))) )
+                Vec_BitWriteEntry( pMan->vFails, Abc_Lit2Var(pObjNew->Value), 1 );
+            if ( Gia_ObjReprObj(p, Gia_ObjId(p, pObj)) == NULL )
+                continue;
+            if ( (pRepr = Cec4_ManFindRepr(p, pMan, Gia_ObjId(p, pObj))) == NULL )
+                continue;
+            if ( Abc_Lit2Var(pObj->Value) == Abc_Lit2Var(pRepr->Value) )
+            {
+                assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
+                Cec4_ManSetProved( pMan, Gia_ObjId(p, pObj), Gia_ObjId(p, pRepr) );
+                if ( Gia_ObjId(p, pRepr) == 0 )
+                    pMan->iLastConst = Gia_ObjId(p, pObj);
+                continue;
+            }
+            iObjNew0 = Abc_Lit2Var(pRepr->Value);
+            iObjNew1 = Abc_Lit2Var(pObj->Value);
+            fCompl   = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
+            fEffort  = pMan->vCoDrivers ? Vec_BitEntry(pMan->vCoDrivers, Gia_ObjId(p, pObj)) || Vec_BitEntry(pMan->vCoDrivers, Gia_ObjId(p, pRepr)) : 0;
+            Vec_IntPushTwo( pPar->vPairs, Gia_ObjId(p, pRepr), Gia_ObjId(p, pObj) );
+            Vec_IntPushTwo( pPar->vQueries, iObjNew0, iObjNew1 );
+            Vec_IntPushTwo( pPar->vQueries, fCompl, fEffort ? pPars->nBTLimitPo : (Vec_BitEntry(pMan->vFails, iObjNew0) || Vec_BitEntry(pMan->vFails, iObjNew1)) ? Abc_MaxInt(1, pPars->nBTLimit/10) : pPars->nBTLimit );
+        }
+        if ( Vec_IntSize(pPar->vPairs) == 0 )
+            continue;
+        // solve the pairs of this wave concurrently
+        Cec4_ParManSolveBatch( pPar );
+        pMan->timePar += Abc_Clock() - clk;
+        // apply the results in the order of nodes
+        Vec_IntForEachEntryDouble( pPar->vPairs, iRepr, iObj, i )
+        {
+            pObj   = Gia_ManObj( p, iObj );
+            pRepr  = Gia_ManObj( p, iRepr );
+            status = Vec_IntEntry( pPar->vStatus, i/2 );
+            nConfs = Vec_IntEntry( pPar->vConfs, i/2 );
+            fCompl = Vec_IntEntry( pPar->vQueries, 2*i+2 );
+            Time   = (abctime)Vec_WrdEntry( pPar->vTimes, i/2 );
+            if ( status == GLUCOSE_SAT )
+            {
+                pMan->nSatSat++;
+                pMan->nPatterns++;
+                if ( pPars->fVerbose )
+                {
+                    pMan->nConflicts[0][0] += nConfs == 0;
+                    pMan->nConflicts[0][1] += nConfs;
+                    pMan->nConflicts[0][2]  = Abc_MaxInt(pMan->nConflicts[0][2], nConfs);
+                }
+                if ( pPars->fVerbose && nConfs == 0 )
+                    pMan->timeSatSat0 += Time;
+                else
+                    pMan->timeSatSat += Time;
+                Cec4_ManSaveCex( pMan, Vec_WecEntry(pPar->vCexes, i/2) );
+            }
+            else if ( status == GLUCOSE_UNSAT )
+            {
+                pMan->nSatUnsat++;
+                if ( pPars->fVerbose )
+                {
+                    pMan->nConflicts[1][0] += nConfs == 0;
+                    pMan->nConflicts[1][1] += nConfs;
+                    pMan->nConflicts[1][2]  = Abc_MaxInt(pMan->nConflicts[1][2], nConfs);
+                }
+                if ( pPars->fVerbose && nConfs == 0 )
+                    pMan->timeSatUnsat0 += Time;
+                else
+                    pMan->timeSatUnsat += Time;
+                pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+                Cec4_ManSetProved( pMan, iObj, iRepr );
+                if ( iRepr == 0 )
+                    pMan->iLastConst = iObj;
+            }
+            else
+            {
+                pMan->nSatUndec++;
+                pMan->timeSatUndec += Time;
+                if ( pMan->vPairs ) // speculate
+                {
+                    Vec_IntPushTwo( pMan->vPairs, Abc_Var2Lit(iRepr, 0), Abc_Var2Lit(iObj, fCompl) );
+                    pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+                    Gia_ObjSetProved( p, iObj ); // not recorded, because it was not proved
+                    if ( iRepr == 0 )
+                        pMan->iLastConst = iObj;
+                }
+                else
+                {
+                    Gia_ObjSetFailed( p, iObj );
+                    Vec_BitWriteEntry( pMan->vFails, iObj, 1 );
+                }
+            }
+        }
+    }
+    Vec_IntFree( vWaves );
+    Vec_IntFree( vClassWaves );
+    Vec_WecFree( vNodes );
+    Cec4_ParManStop( pPar );
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
 
     Cec4_Man_t * pMan = Cec4_ManCreate( p, pPars ); 
     Gia_Obj_t * pObj, * pRepr; 
     int i, fSimulate = 1, Id;
+    if ( pPars->nProcs > CEC_PAR_THR_MAX )
+    {
+        printf( "The number of threads (%d) exceeds the precompiled limit (%d). Using %d threads.\n", pPars->nProcs, CEC_PAR_THR_MAX, CEC_PAR_THR_MAX );
+        pPars->nProcs = CEC_PAR_THR_MAX;
+    }
     if ( pPars->fVerbose )
         printf( "Solver type = %d. Simulate %d words in %d rounds. SAT with %d confs. Recycle after %d SAT calls.\n", 
             pPars->jType, pPars->nWords, pPars->nRounds, pPars->nBTLimit, pPars->nCallsRecycle );
@@ -1946,6 +2605,9 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
     pMan->pNew = Cec4_ManStartNew( p );
+    if ( pPars->nProcs > 1 && !pPars->fBMiterInfo )
+        Cec4_ManSweepLevels( p, pMan );
+    else
     Gia_ManForEachAnd( p, pObj, i )
     {
         Gia_Obj_t * pObjNew; 
@@ -1984,7 +2646,7 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
             }
 
             assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
-            Gia_ObjSetProved( p, i );
+            Cec4_ManSetProved( pMan, i, Gia_ObjId(p, pRepr) );
             if ( Gia_ObjId(p, pRepr) == 0 )
                 pMan->iLastConst = i;
             continue;
@@ -2013,9 +2675,11 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     if ( p->iPatsPi > 0 )
     {
         abctime clk2 = Abc_Clock();
-        Cec4_ManSimulate( p, pMan );
+        // only the words holding the new patterns have changed
+        Cec4_ManSimulateTfo( p, pMan, Abc_Bit6WordNum(p->iPatsPi + 1) );
         p->iPatsPi = 0;
         Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+        pMan->iCexStamp = 0;
         pMan->timeResimGlo += Abc_Clock() - clk2;
     }
     if ( pPars->fVerbose )
@@ -2028,12 +2692,12 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     }
 finalize:
     if ( pPars->fVerbose )
-        printf( "SAT calls = %d:  P = %d (0=%d a=%.2f m=%d)  D = %d (0=%d a=%.2f m=%d)  F = %d   Sim = %d  Recyc = %d  Xor = %.2f %%\n", 
+        printf( "SAT calls = %d:  P = %d (0=%d a=%.2f m=%d)  D = %d (0=%d a=%.2f m=%d)  F = %d   Sim = %d  Pack = %d  Recyc = %d  Xor = %.2f %%\n", 
             pMan->nSatUnsat + pMan->nSatSat + pMan->nSatUndec, 
             pMan->nSatUnsat, pMan->nConflicts[1][0], (float)pMan->nConflicts[1][1]/Abc_MaxInt(1, pMan->nSatUnsat-pMan->nConflicts[1][0]), pMan->nConflicts[1][2],
             pMan->nSatSat,   pMan->nConflicts[0][0], (float)pMan->nConflicts[0][1]/Abc_MaxInt(1, pMan->nSatSat  -pMan->nConflicts[0][0]), pMan->nConflicts[0][2],  
             pMan->nSatUndec,  
-            pMan->nSimulates, pMan->nRecycles, 100.0*pMan->nGates[1]/Abc_MaxInt(1, pMan->nGates[0]+pMan->nGates[1]) );
+            pMan->nSimulates, pMan->nPatsPacked, pMan->nRecycles, 100.0*pMan->nGates[1]/Abc_MaxInt(1, pMan->nGates[0]+pMan->nGates[1]) );
     if ( pMan->vPairs && Vec_IntSize(pMan->vPairs) )
     {
         extern char * Extra_FileNameGeneric( char * FileName );
@@ -2084,6 +2748,17 @@ Gia_Man_t * Cec4_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose )
     Cec4_ManPerformSweeping( p, pPars, &pNew, 0 );
     return pNew;
 }
+Gia_Man_t * Cec4_ManSimulateTestPar( Gia_Man_t * p, int nBTLimit, int nProcs, int fVerbose )
+{
+    Gia_Man_t * pNew = NULL;
+    Cec_ParFra_t ParsFra, * pPars = &ParsFra;
+    Cec4_ManSetParams( pPars );
+    pPars->fVerbose = fVerbose;
+    pPars->nBTLimit = nBTLimit;
+    pPars->nProcs   = nProcs;
+    Cec4_ManPerformSweeping( p, pPars, &pNew, 0 );
+    return pNew;
+}
 Gia_Man_t * Cec4_ManSimulateTest4( Gia_Man_t * p, int nBTLimit, int nBTLimitPo, int fVerbose )
 {
     Gia_Man_t * pNew = NULL;
@@ -2103,6 +2778,234 @@ int Cec4_ManSimulateOnlyTest( Gia_Man_t * p, int fVerbose )
     return Cec4_ManPerformSweeping( p, pPars, NULL, 1 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Persistent cache of equivalences and patterns.]
+
+  Description [The cache is a binary file keyed by the structural hash
+  of the specification. It stores the equivalences among the nodes of
+  the specification (including constant nodes) proved in the previous
+  runs and the patterns that disproved the candidate equivalences.
+  When the cache is loaded, the specification is reduced using the 
+  equivalences and the patterns are used as the initial simulation
+  info of the miter instead of random simulation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define CEC4_CACHE_MAGIC    0x34434543  // "CEC4"
+#define CEC4_CACHE_WORDS    16          // the max number of pattern words to store
+
+word Cec4_ManCacheKey( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i;
+    word Key = ABC_CONST(0xCBF29CE484222325);
+    Key = (Key ^ (word)Gia_ManCiNum(p)) * ABC_CONST(0x100000001B3);
+    Key = (Key ^ (word)Gia_ManCoNum(p)) * ABC_CONST(0x100000001B3);
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Key = (Key ^ (word)Gia_ObjFaninLit0(pObj, i)) * ABC_CONST(0x100000001B3);
+        Key = (Key ^ (word)Gia_ObjFaninLit1(pObj, i)) * ABC_CONST(0x100000001B3);
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        Key = (Key ^ (word)Gia_ObjFaninLit0p(p, pObj)) * ABC_CONST(0x100000001B3);
+    return Key;
+}
+Gia_Man_t * Cec4_ManCacheLoad( Gia_Man_t * pSpec, char * pFileName, Vec_Wrd_t ** pvSimsPi, int fVerbose )
+{
+    Gia_Man_t * pNew = NULL;
+    Vec_Int_t * vPairs = NULL;
+    word Key, Header[5]; 
+    int i, iObj, iRepr, RetValue = 1;
+    FILE * pFile = fopen( pFileName, "rb" );
+    *pvSimsPi = NULL;
+    if ( pFile == NULL )
+    {
+        if ( fVerbose )
+            printf( "The cache file \"%s\" does not exist yet.\n", pFileName );
+        return NULL;
+    }
+    // header: magic, key, objects, CIs, pairs; followed by the pairs, the number of words, and the patterns
+    Key = Cec4_ManCacheKey( pSpec );
+    RetValue &= fread( Header, sizeof(word), 5, pFile ) == 5;
+    if ( !RetValue || Header[0] != CEC4_CACHE_MAGIC || Header[1] != Key || 
+         Header[2] != (word)Gia_ManObjNum(pSpec) || Header[3] != (word)Gia_ManCiNum(pSpec) )
+    {
+        printf( "The cache file \"%s\" does not match the specification and is ignored.\n", pFileName );
+        fclose( pFile );
+        return NULL;
+    }
+    vPairs = Vec_IntStart( 2 * (int)Header[4] );
+    RetValue &= fread( Vec_IntArray(vPairs), sizeof(int), Vec_IntSize(vPairs), pFile ) == (size_t)Vec_IntSize(vPairs);
+    RetValue &= fread( Header, sizeof(word), 1, pFile ) == 1;
+    if ( RetValue && Header[0] > 0 && Header[0] <= CEC4_CACHE_WORDS )
+    {
+        *pvSimsPi = Vec_WrdStart( Gia_ManCiNum(pSpec) * (int)Header[0] );
+        RetValue &= fread( Vec_WrdArray(*pvSimsPi), sizeof(word), Vec_WrdSize(*pvSimsPi), pFile ) == (size_t)Vec_WrdSize(*pvSimsPi);
+    }
+    fclose( pFile );
+    Vec_IntForEachEntryDouble( vPairs, iObj, iRepr, i )
+        RetValue &= iRepr >= 0 && iRepr < iObj && iObj < Gia_ManObjNum(pSpec) && Gia_ObjIsAnd(Gia_ManObj(pSpec, iObj));
+    if ( !RetValue )
+    {
+        printf( "The cache file \"%s\" is corrupted and is ignored.\n", pFileName );
+        Vec_WrdFreeP( pvSimsPi );
+        Vec_IntFree( vPairs );
+        return NULL;
+    }
+    // reduce the specification using the equivalences
+    if ( Vec_IntSize(vPairs) > 0 )
+    {
+        ABC_FREE( pSpec->pReprs );
+        ABC_FREE( pSpec->pNexts );
+        pSpec->pReprs = ABC_CALLOC( Gia_Rpr_t, Gia_ManObjNum(pSpec) );
+        for ( i = 0; i < Gia_ManObjNum(pSpec); i++ )
+            Gia_ObjSetRepr( pSpec, i, GIA_VOID );
+        Vec_IntForEachEntryDouble( vPairs, iObj, iRepr, i )
+            Gia_ObjSetRepr( pSpec, iObj, iRepr );
+        pSpec->pNexts = Gia_ManDeriveNexts( pSpec );
+        pNew = Gia_ManEquivReduce( pSpec, 1, 0, 0, 0 );
+    }
+    if ( fVerbose )
+        printf( "Loaded %d equivalences and %d patterns from the cache file \"%s\".\n", 
+            Vec_IntSize(vPairs)/2, *pvSimsPi ? 64 * Vec_WrdSize(*pvSimsPi) / Gia_ManCiNum(pSpec) : 0, pFileName );
+    Vec_IntFree( vPairs );
+    return pNew;
+}
+// maps the nodes of the specification into the literals of the miter (or -1)
+Vec_Int_t * Cec4_ManCacheMapSpec( Gia_Man_t * pSpec, Gia_Man_t * pMiter )
+{
+    Vec_Int_t * vMap = Vec_IntStartFull( Gia_ManObjNum(pSpec) );
+    Gia_Obj_t * pObj; int i, iLit0, iLit1, iLit;
+    Vec_IntWriteEntry( vMap, 0, 0 );
+    Gia_ManForEachCi( pSpec, pObj, i )
+        Vec_IntWriteEntry( vMap, Gia_ObjId(pSpec, pObj), Abc_Var2Lit(Gia_ObjId(pMiter, Gia_ManCi(pMiter, i)), 0) );
+    if ( pSpec->pReprs )
+        Gia_ManSetPhase( pSpec );
+    Gia_ManHashStart( pMiter );
+    Gia_ManForEachAnd( pSpec, pObj, i )
+    {
+        // the nodes merged by the cached equivalences are represented by their representatives
+        if ( pSpec->pReprs && Gia_ObjRepr(pSpec, i) != GIA_VOID )
+        {
+            Gia_Obj_t * pRepr = Gia_ObjReprObj( pSpec, i );
+            if ( (iLit = Vec_IntEntry(vMap, Gia_ObjId(pSpec, pRepr))) >= 0 )
+                Vec_IntWriteEntry( vMap, i, Abc_LitNotCond(iLit, pObj->fPhase ^ pRepr->fPhase) );
+            continue;
+        }
+        iLit0 = Vec_IntEntry( vMap, Gia_ObjFaninId0(pObj, i) );
+        iLit1 = Vec_IntEntry( vMap, Gia_ObjFaninId1(pObj, i) );
+        if ( iLit0 < 0 || iLit1 < 0 )
+            continue;
+        iLit0 = Abc_LitNotCond( iLit0, Gia_ObjFaninC0(pObj) );
+        iLit1 = Abc_LitNotCond( iLit1, Gia_ObjFaninC1(pObj) );
+        if ( iLit0 == 0 || iLit1 == 0 || iLit0 == Abc_LitNot(iLit1) )
+            iLit = 0;
+        else if ( iLit0 == 1 || iLit0 == iLit1 )
+            iLit = iLit1;
+        else if ( iLit1 == 1 )
+            iLit = iLit0;
+        else if ( !(iLit = Gia_ManHashLookupInt(pMiter, iLit0, iLit1)) )
+            continue;
+        Vec_IntWriteEntry( vMap, i, iLit );
+    }
+    Gia_ManHashStop( pMiter );
+    return vMap;
+}
+// packs the recorded patterns over the CIs of the miter followed by the earlier patterns
+Vec_Wrd_t * Cec4_ManCachePatterns( Gia_Man_t * pMiter, Vec_Wrd_t * vSimsOld )
+{
+    Vec_Int_t * vPats = pMiter->vPats;
+    int nCis = Gia_ManCiNum(pMiter);
+    int i, k, w, iLit, nPats = 0, nWords, nWordsNew, nWordsOld = vSimsOld ? Vec_WrdSize(vSimsOld) / nCis : 0;
+    Vec_Wrd_t * vSimsPi;
+    for ( i = 0; vPats && i < Vec_IntSize(vPats); i += Vec_IntEntry(vPats, i) )
+        nPats++;
+    // the first pattern is all-zero
+    nWordsNew = Abc_MinInt( Abc_Bit6WordNum(nPats + 1), CEC4_CACHE_WORDS );
+    nWords    = Abc_MinInt( nWordsNew + nWordsOld, CEC4_CACHE_WORDS );
+    if ( nPats == 0 && nWordsOld == 0 )
+        return NULL;
+    vSimsPi = Vec_WrdStartRandom( nCis * nWords );
+    for ( i = 0; i < nCis; i++ )
+        Vec_WrdEntryP(vSimsPi, i * nWords)[0] <<= 1;
+    for ( i = 0, nPats = 1; vPats && i < Vec_IntSize(vPats) && nPats < 64 * nWordsNew; i += Vec_IntEntry(vPats, i), nPats++ )
+        for ( k = 1; k < Vec_IntEntry(vPats, i)-1; k++ )
+        {
+            Gia_Obj_t * pObj = Gia_ManObj( pMiter, Abc_Lit2Var(iLit = Vec_IntEntry(vPats, i+k)) );
+            word * pSim;
+            if ( !Gia_ObjIsCi(pObj) )
+                continue;
+            pSim = Vec_WrdEntryP( vSimsPi, Gia_ObjCioId(pObj) * nWords );
+            if ( Abc_InfoHasBit( (unsigned*)pSim, nPats ) != Abc_LitIsCompl(iLit) )
+                Abc_InfoXorBit( (unsigned*)pSim, nPats );
+        }
+    for ( w = nWordsNew; w < nWords; w++ )
+        for ( i = 0; i < nCis; i++ )
+            Vec_WrdWriteEntry( vSimsPi, i * nWords + w, Vec_WrdEntry(vSimsOld, i * nWordsOld + w - nWordsNew) );
+    return vSimsPi;
+}
+void Cec4_ManCacheSave( Gia_Man_t * pSpec, Gia_Man_t * pMiter, Vec_Wrd_t * vSimsOld, char * pFileName, int fVerbose )
+{
+    Vec_Int_t * vMap   = Cec4_ManCacheMapSpec( pSpec, pMiter );
+    Vec_Int_t * vFirst = Vec_IntStartFull( Gia_ManObjNum(pMiter) );
+    Vec_Int_t * vRoots = Vec_IntStartNatural( Gia_ManObjNum(pMiter) );
+    Vec_Int_t * vPairs = Vec_IntAlloc( 1000 );
+    Vec_Wrd_t * vSimsPi = Cec4_ManCachePatterns( pMiter, vSimsOld );
+    Gia_Obj_t * pObj; int i, iObj, iLit, iKey;
+    word Header[5];
+    FILE * pFile;
+    // the proved nodes are merged with the class members they were proved against;
+    // these were proved earlier, so their roots are known (the phase is implied by fPhase)
+    if ( pMiter->vProved )
+        Vec_IntForEachEntryDouble( pMiter->vProved, iObj, iLit, i )
+        {
+            assert( Abc_Lit2Var(iLit) < iObj );
+            Vec_IntWriteEntry( vRoots, iObj, Vec_IntEntry(vRoots, Abc_Lit2Var(iLit)) );
+        }
+    // the spec nodes are equivalent if they map into the same node or into nodes with the same root
+    Gia_ManForEachAnd( pSpec, pObj, i )
+    {
+        if ( Vec_IntEntry(vMap, i) < 0 )
+            continue;
+        iKey = Vec_IntEntry( vRoots, Abc_Lit2Var(Vec_IntEntry(vMap, i)) );
+        if ( iKey == 0 )
+            Vec_IntPushTwo( vPairs, i, 0 );
+        else if ( Vec_IntEntry(vFirst, iKey) == -1 )
+            Vec_IntWriteEntry( vFirst, iKey, i );
+        else
+            Vec_IntPushTwo( vPairs, i, Vec_IntEntry(vFirst, iKey) );
+    }
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+        printf( "Cannot open the cache file \"%s\" for writing.\n", pFileName );
+    else
+    {
+        Header[0] = CEC4_CACHE_MAGIC;
+        Header[1] = Cec4_ManCacheKey( pSpec );
+        Header[2] = Gia_ManObjNum( pSpec );
+        Header[3] = Gia_ManCiNum( pSpec );
+        Header[4] = Vec_IntSize( vPairs ) / 2;
+        fwrite( Header, sizeof(word), 5, pFile );
+        fwrite( Vec_IntArray(vPairs), sizeof(int), Vec_IntSize(vPairs), pFile );
+        Header[0] = vSimsPi ? Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pMiter) : 0;
+        fwrite( Header, sizeof(word), 1, pFile );
+        if ( vSimsPi )
+            fwrite( Vec_WrdArray(vSimsPi), sizeof(word), Vec_WrdSize(vSimsPi), pFile );
+        fclose( pFile );
+        if ( fVerbose )
+            printf( "Saved %d equivalences and %d patterns into the cache file \"%s\".\n", 
+                Vec_IntSize(vPairs)/2, vSimsPi ? 64 * (int)Header[0] : 0, pFileName );
+    }
+    Vec_WrdFreeP( &vSimsPi );
+    Vec_IntFree( vPairs );
+    Vec_IntFree( vRoots );
+    Vec_IntFree( vFirst );
+    Vec_IntFree( vMap );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Internal simulation APIs.]
@@ -4228,7 +5131,7 @@ void Cec4_CallSATsolver(Gia_Man_t * p, Cec4_Man_t * pMan, Cec_ParFra_t * pPars){
               pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
             }
             assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
-            Gia_ObjSetProved( p, i );
+            Cec4_ManSetProved( pMan, i, Gia_ObjId(p, pRepr) );
             if ( Gia_ObjId(p, pRepr) == 0 )
                 pMan->iLastConst = i;
             continue;
@@ -188,7 +188,8 @@ void Cec_AddClausesSuper( Cec_ManSat_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSupe
     assert( Gia_ObjIsAnd( pNode ) );
     // create storage for literals
     nLits = Vec_PtrSize(vSuper) + 1;
-    pLits = ABC_ALLOC( int, nLits );
+    Vec_IntFill( p->vLits, nLits, 0 );
+    pLits = Vec_IntArray( p->vLits );
     // suppose AND-gate is A & B = C
     // add !A => !C   or   A + !C
     Vec_PtrForEachEntry( Gia_Obj_t *, vSuper, pFanin, i )
@@ -219,7 +220,6 @@ void Cec_AddClausesSuper( Cec_ManSat_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSupe
     }
     RetValue = sat_solver_addclause( p->pSat, pLits, pLits + nLits );
     assert( RetValue );
-    ABC_FREE( pLits );
 }
 
 /**Function*************************************************************
@@ -320,7 +320,8 @@ void Cec_CnfNodeAddToSolver( Cec_ManSat_t * p, Gia_Obj_t * pObj )
     }
     assert( Gia_ObjIsAnd(pObj) );
     // start the frontier
-    vFrontier = Vec_PtrAlloc( 100 );
+    vFrontier = p->vFrontier;
+    Vec_PtrClear( vFrontier );
     Cec_ObjAddToFrontier( p, pObj, vFrontier );
     // explore nodes in the frontier
     Vec_PtrForEachEntry( Gia_Obj_t *, vFrontier, pNode, i )
@@ -347,7 +348,6 @@ void Cec_CnfNodeAddToSolver( Cec_ManSat_t * p, Gia_Obj_t * pObj )
         }
         assert( Vec_PtrSize(p->vFanins) > 1 );
     }
-    Vec_PtrFree( vFrontier );
 }
 
 
@@ -373,11 +373,17 @@ void Cec_ManSatSolverRecycle( Cec_ManSat_t * p )
             Cec_ObjSetSatNum( p, pObj, 0 );
         Vec_PtrClear( p->vUsedNodes );
 //        memset( p->pSatVars, 0, sizeof(int) * Gia_ManObjNumMax(p->pAigTotal) );
-        sat_solver_delete( p->pSat );
+        // keep the memory of the watch lists and the clauses
+        sat_solver_restart( p->pSat );
+        veci_resize( &p->pSat->unit_lits, 0 );
+        sat_solver_setnvars( p->pSat, 1000 );
+    }
+    else
+    {
+        p->pSat = sat_solver_new();
+        sat_solver_setnvars( p->pSat, 1000 );
+        p->pSat->factors = ABC_CALLOC( double, p->pSat->cap );
     }
-    p->pSat = sat_solver_new();
-    sat_solver_setnvars( p->pSat, 1000 );
-    p->pSat->factors = ABC_CALLOC( double, p->pSat->cap );
     // var 0 is not used
     // var 1 is reserved for const0 node - add the clause
     p->nSatVars = 1;
@@ -24,6 +24,7 @@
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
+#include "cec.h"
 //#include "bdd/cudd/cuddInt.h"
 
 #ifdef ABC_USE_PTHREADS
@@ -46,7 +47,7 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nConfLimit, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
 
@@ -537,7 +538,6 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 100
 typedef struct Par_ThData_t_
 {
     Gia_Man_t * p;
@@ -572,8 +572,8 @@ void * Cec_GiaSplitWorkerThread( void * pArg )
 int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
-    Par_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
+    Par_ThData_t ThData[CEC_PAR_THR_MAX];
+    pthread_t WorkerThread[CEC_PAR_THR_MAX];
     Vec_Ptr_t * vStack;
     Cnf_Dat_t * pCnf;
     double Progress = 0;
@@ -589,7 +589,7 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
         return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
     // subtract manager thread
     nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
+    assert( nProcs >= 1 && nProcs <= CEC_PAR_THR_MAX );
     // check the problem
     pCnf = Cec_GiaDeriveGiaRemapped( p );
     status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
@@ -737,7 +737,329 @@ finish:
     }
     return RetValue;
 }
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+/**Function*************************************************************
+
+  Synopsis    [Cube-and-conquer.]
+
+  Description [The miter is divided into cubes (partial assignments of
+  the primary inputs) by a look-ahead cuber, which cofactors the miter
+  w.r.t. the best few candidate inputs and selects the one maximizing
+  the product of the size reductions in both cofactors, resulting in
+  balanced cubes. Each worker thread owns one incremental SAT solver,
+  which is created once from the shared CNF and solves the cubes under
+  assumptions, keeping the learned clauses. A cube whose conflict limit
+  is exhausted is split again by the worker, which has a private copy
+  of the miter for this purpose.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec_CubeMan_t_ Cec_CubeMan_t;
+struct Cec_CubeMan_t_
+{
+    Gia_Man_t *      p;            // single-output miter
+    Cnf_Dat_t *      pCnf;         // CNF of the miter shared by the solvers
+    Vec_Ptr_t *      vCubes;       // cubes to be solved (literals of the PI indexes)
+    int              nConfLimit;   // conflict limit per cube
+    int              nTimeOut;     // runtime limit per cube
+    int              nIterMax;     // the max number of splits
+    int              LookAhead;    // the number of candidate variables
+    int              fVerbose;     // verbose flag
+    int              nBusy;        // the number of workers solving a cube
+    int              nSolved;      // the number of cubes solved
+    int              nSplits;      // the number of cubes split
+    int              fStop;        // the workers should exit
+    int              fUndec;       // some cube was dropped without being decided
+    double           Progress;     // the fraction of the search space covered
+    Abc_Cex_t *      pCex;         // the counter-example
+    abctime          clkStart;     // starting time
+    pthread_mutex_t  Mutex;
+    pthread_cond_t   Cond;
+};
+typedef struct Cec_CubeThData_t_
+{
+    Cec_CubeMan_t *  pMan;
+    Gia_Man_t *      pCopy;        // private copy of the miter used by the cuber
+    int              iThread;
+} Cec_CubeThData_t;
+
+static inline Gia_Man_t * Cec_GiaCubeCofactor( Gia_Man_t * p, Vec_Int_t * vCube )
+{
+    extern void Gia_ManDupCofactorVar_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj );
+    Gia_Man_t * pNew, * pTemp;
+    Gia_Obj_t * pObj;
+    int i, iLit;
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi(pNew);
+    Vec_IntForEachEntry( vCube, iLit, i )
+        Gia_ManPi( p, Abc_Lit2Var(iLit) )->Value = !Abc_LitIsCompl(iLit);
+    Gia_ManHashAlloc( pNew );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManDupCofactorVar_rec( pNew, p, Gia_ObjFanin0(pObj) );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+// splits the cube into two subcubes; returns the number of subcubes added (0, 1, or 2) or -1 if the cube cannot be split
+int Cec_GiaCubeSplit( Gia_Man_t * p, Vec_Int_t * vCube, int LookAhead, Vec_Ptr_t * vRes )
+{
+    Gia_Man_t * pCof, * pPart;
+    Vec_Int_t * vNew;
+    double Score, ScoreBest = -1;
+    int * pOrder, i, n, iVar, iBest = -1, nCands, nAdded = 0;
+    int fConst0[2] = {0}, fConst0Best[2] = {0};
+    pCof = Cec_GiaCubeCofactor( p, vCube );
+    if ( Gia_ManPoIsConst0(pCof, 0) )
+    {
+        Gia_ManStop( pCof );
+        return 0;
+    }
+    // candidates are the PIs with the largest number of fanouts in the cofactor
+    pOrder = Gia_PermuteSpecialOrder( pCof );
+    nCands = Abc_MinInt( LookAhead, Gia_ManPiNum(pCof) );
+    for ( i = 0; i < nCands; i++ )
+    {
+        iVar = pOrder[i];
+        if ( Gia_ObjRefNum(pCof, Gia_ManPi(pCof, iVar)) == 0 )
+            break;
+        if ( nCands == 1 )
+        {
+            iBest = iVar;
+            break;
+        }
+        Score = 1;
+        for ( n = 0; n < 2; n++ )
+        {
+            pPart = Gia_ManDupCofactorVar( pCof, iVar, n );
+            fConst0[n] = Gia_ManPoIsConst0( pPart, 0 );
+            Score *= 1 + Gia_ManAndNum(pCof) - Gia_ManAndNum(pPart);
+            Gia_ManStop( pPart );
+        }
+        if ( ScoreBest < Score )
+        {
+            ScoreBest = Score, iBest = iVar;
+            fConst0Best[0] = fConst0[0];
+            fConst0Best[1] = fConst0[1];
+        }
+    }
+    ABC_FREE( pOrder );
+    Gia_ManStop( pCof );
+    if ( iBest == -1 ) // the cofactor does not depend on the PIs
+        return -1;
+    for ( n = 0; n < 2; n++ )
+    {
+        if ( fConst0Best[n] )
+            continue;
+        vNew = Vec_IntAlloc( Vec_IntSize(vCube) + 1 );
+        Vec_IntAppend( vNew, vCube );
+        Vec_IntPush( vNew, Abc_Var2Lit(iBest, !n) );
+        Vec_PtrPush( vRes, vNew );
+        nAdded++;
+    }
+    return nAdded;
+}
+static inline void Cec_GiaCubeFree( Vec_Ptr_t * vCubes )
+{
+    Vec_Int_t * vCube;
+    int i;
+    Vec_PtrForEachEntry( Vec_Int_t *, vCubes, vCube, i )
+        Vec_IntFree( vCube );
+    Vec_PtrFree( vCubes );
+}
+void * Cec_GiaCubeWorkerThread( void * pArg )
+{
+    Cec_CubeThData_t * pThData = (Cec_CubeThData_t *)pArg;
+    Cec_CubeMan_t * p = pThData->pMan;
+    Vec_Ptr_t * vNew = Vec_PtrAlloc( 2 );
+    Vec_Int_t * vLits = Vec_IntAlloc( 100 );
+    Vec_Int_t * vCube;
+    sat_solver * pSat = Cec_GiaDeriveSolver( p->p, p->pCnf, 0 );
+    int i, iLit, status, nConfs, nAdded = 0, Depth;
+    assert( pSat != NULL );
+    while ( 1 )
+    {
+        // get the next cube
+        pthread_mutex_lock( &p->Mutex );
+        while ( !p->fStop && Vec_PtrSize(p->vCubes) == 0 && p->nBusy > 0 )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        if ( p->fStop || Vec_PtrSize(p->vCubes) == 0 )
+        {
+            pthread_cond_broadcast( &p->Cond );
+            pthread_mutex_unlock( &p->Mutex );
+            break;
+        }
+        vCube = (Vec_Int_t *)Vec_PtrPop( p->vCubes );
+        p->nBusy++;
+        pthread_mutex_unlock( &p->Mutex );
+        // solve the cube under assumptions
+        Vec_IntClear( vLits );
+        Vec_IntForEachEntry( vCube, iLit, i )
+            Vec_IntPush( vLits, Abc_Var2Lit(p->pCnf->pVarNums[Gia_ObjId(p->p, Gia_ManPi(p->p, Abc_Lit2Var(iLit)))], Abc_LitIsCompl(iLit)) );
+        sat_solver_set_runtime_limit( pSat, p->nTimeOut ? p->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
+        nConfs = sat_solver_nconflicts( pSat );
+        status = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), (ABC_INT64_T)p->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+        nConfs = sat_solver_nconflicts( pSat ) - nConfs;
+        // split the undecided cube using the private copy of the miter
+        Vec_PtrClear( vNew );
+        if ( status == l_Undef )
+            nAdded = Cec_GiaCubeSplit( pThData->pCopy, vCube, p->LookAhead, vNew );
+        // update the manager
+        Depth = Vec_IntSize(vCube);
+        pthread_mutex_lock( &p->Mutex );
+        if ( status == l_True )
+        {
+            if ( p->pCex == NULL )
+                p->pCex = Cec_SplitDeriveModel( p->p, p->pCnf, pSat );
+            p->fStop = 1;
+        }
+        else if ( status == l_False )
+            p->nSolved++, p->Progress += 1.0 / pow((double)2, (double)Depth);
+        else if ( nAdded == -1 ) // the cube cannot be split further
+            p->fStop = p->fUndec = 1;
+        else
+        {
+            // the parts of the cube not covered by the subcubes are solved
+            p->Progress += (2 - nAdded) / pow((double)2, (double)(Depth + 1));
+            Vec_PtrAppend( p->vCubes, vNew );
+            if ( ++p->nSplits >= p->nIterMax && p->nIterMax )
+                p->fStop = 1;
+        }
+        if ( p->fVerbose )
+            Cec_GiaSplitPrint( pThData->iThread+1, Depth, sat_solver_nvars(pSat), nConfs, status == l_True ? 0 : (status == l_False ? 1 : -1), p->Progress, Abc_Clock() - p->clkStart );
+        p->nBusy--;
+        pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+        Vec_IntFree( vCube );
+    }
+    sat_solver_delete( pSat );
+    Vec_IntFree( vLits );
+    Vec_PtrFree( vNew );
+    return NULL;
+}
+int Cec_GiaCubeTestInt( Gia_Man_t * p, int nProcs, int nConfLimit, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fSilent )
+{
+    Cec_CubeMan_t Man, * pMan = &Man;
+    Cec_CubeThData_t ThData[CEC_PAR_THR_MAX];
+    pthread_t WorkerThread[CEC_PAR_THR_MAX];
+    Vec_Ptr_t * vNext;
+    Vec_Int_t * vCube;
+    sat_solver * pSat;
+    int i, nAdded, status, RetValue = -1, fSplit = 1;
+    assert( Gia_ManPoNum(p) == 1 );
+    nProcs = Abc_MaxInt( 1, Abc_MinInt(nProcs, CEC_PAR_THR_MAX) );
+    Abc_CexFreeP( &p->pCexComb );
+    memset( pMan, 0, sizeof(Cec_CubeMan_t) );
+    pMan->p          = p;
+    pMan->nConfLimit = nConfLimit;
+    pMan->nTimeOut   = nTimeOut;
+    pMan->nIterMax   = nIterMax;
+    pMan->LookAhead  = LookAhead;
+    pMan->fVerbose   = fVerbose;
+    pMan->clkStart   = Abc_Clock();
+    if ( fVerbose )
+        printf( "Solving CEC problem by cube-and-conquer with the following parameters:\n" );
+    if ( fVerbose )
+        printf( "Threads = %d   ConfLimit = %d   TimeOut = %d sec   MaxIter = %d   LookAhead = %d   Verbose = %d.\n", nProcs, nConfLimit, nTimeOut, nIterMax, LookAhead, fVerbose );
+    fflush( stdout );
+    // check the problem
+    pMan->pCnf = Cec_GiaDeriveGiaRemapped( p );
+    pSat = Cec_GiaDeriveSolver( p, pMan->pCnf, nTimeOut );
+    status = pSat ? sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 ) : l_False;
+    if ( fVerbose )
+        Cec_GiaSplitPrint( 0, 0, pSat ? sat_solver_nvars(pSat) : 0, pSat ? sat_solver_nconflicts(pSat) : 0, status == l_True ? 0 : (status == l_False ? 1 : -1), 0, Abc_Clock() - pMan->clkStart );
+    if ( status == l_True )
+        p->pCexComb = Cec_SplitDeriveModel( p, pMan->pCnf, pSat );
+    if ( pSat )
+        sat_solver_delete( pSat );
+    if ( status != l_Undef )
+    {
+        Cnf_DataFree( pMan->pCnf );
+        if ( !fSilent )
+            printf( "The problem is %s without cubing.\n", status == l_True ? "SAT" : "UNSAT" );
+        return status == l_True ? 0 : 1;
+    }
+    // generate the initial cubes level by level
+    pMan->vCubes = Vec_PtrAlloc( 1000 );
+    Vec_PtrPush( pMan->vCubes, Vec_IntAlloc(0) );
+    while ( fSplit && Vec_PtrSize(pMan->vCubes) > 0 && Vec_PtrSize(pMan->vCubes) < 2 * nProcs )
+    {
+        fSplit = 0;
+        vNext = Vec_PtrAlloc( 2 * Vec_PtrSize(pMan->vCubes) );
+        Vec_PtrForEachEntry( Vec_Int_t *, pMan->vCubes, vCube, i )
+        {
+            nAdded = Cec_GiaCubeSplit( p, vCube, LookAhead, vNext );
+            if ( nAdded == -1 )
+            {
+                Vec_PtrPush( vNext, Vec_IntDup(vCube) );
+                continue;
+            }
+            pMan->Progress += (2 - nAdded) / pow((double)2, (double)(Vec_IntSize(vCube) + 1));
+            pMan->nSplits++;
+            fSplit = 1;
+        }
+        Cec_GiaCubeFree( pMan->vCubes );
+        pMan->vCubes = vNext;
+    }
+    if ( fVerbose )
+        printf( "Generated %d initial cubes.\n", Vec_PtrSize(pMan->vCubes) );
+    // start the workers
+    pthread_mutex_init( &pMan->Mutex, NULL );
+    pthread_cond_init( &pMan->Cond, NULL );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pMan    = pMan;
+        ThData[i].pCopy   = Gia_ManDup( p );
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaCubeWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pthread_join( WorkerThread[i], NULL );
+        Gia_ManStop( ThData[i].pCopy );
+    }
+    pthread_cond_destroy( &pMan->Cond );
+    pthread_mutex_destroy( &pMan->Mutex );
+    // collect the results
+    if ( pMan->pCex )
+        p->pCexComb = pMan->pCex, RetValue = 0;
+    else if ( Vec_PtrSize(pMan->vCubes) == 0 && !pMan->fUndec )
+        RetValue = 1;
+    Cec_GiaCubeFree( pMan->vCubes );
+    Cnf_DataFree( pMan->pCnf );
+    if ( !fSilent )
+    {
+        if ( RetValue == 0 )
+            printf( "Problem is SAT " );
+        else if ( RetValue == 1 )
+            printf( "Problem is UNSAT " );
+        else
+            printf( "Problem is UNDECIDED " );
+        printf( "after solving %d cubes and %d splits.  ", pMan->nSolved, pMan->nSplits );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - pMan->clkStart );
+        fflush( stdout );
+    }
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nConfLimit, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     Abc_Cex_t * pCex = NULL;
     Gia_Man_t * pOne;
@@ -749,8 +1071,10 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
         pOne = Gia_ManDupOutputGroup( p, i, i+1 );
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
-        RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
-        Gia_ManStop( pOne );
+        if ( nConfLimit )
+            RetValue1 = Cec_GiaCubeTestInt( pOne, nProcs, nConfLimit, nTimeOut, nIterMax, LookAhead, fVerbose, fSilent );
+        else
+            RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
         {
@@ -760,6 +1084,7 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
         }
         if ( RetValue1 == -1 )
             fOneUndef = 1;
+        Gia_ManStop( pOne );
     }
     if ( RetValue == -1 )
         RetValue = fOneUndef ? -1 : 1;
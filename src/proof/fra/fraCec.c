@@ -172,12 +172,10 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         assert( Aig_ManRegNum(pMan) == 0 );
         pMan->pData = NULL;
 
-        // derive CNF
-        pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
-    //    pCnf = Cnf_DeriveSimple( pMan, Aig_ManCoNum(pMan) );
-
-        if ( fFlipBits ) 
-            Cnf_DataTranformPolarity( pCnf, 0 );
+        // derive CNF directly into the SAT solver
+        pSat = (sat_solver *)Cnf_DeriveIntoSolver( pMan, Aig_ManCoNum(pMan), fFlipBits, &pCnf );
+        if ( pSat == NULL )
+            return 1;
 
         if ( fVerbose )
         {
@@ -185,14 +183,6 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
             Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
         }
 
-        // convert into SAT solver
-        pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
-        if ( pSat == NULL )
-        {
-            Cnf_DataFree( pCnf );
-            return 1;
-        }
-
         if ( nLearnedStart )
             pSat->nLearntStart = pSat->nLearntMax = nLearnedStart;
         if ( nLearnedDelta )
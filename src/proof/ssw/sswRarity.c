@@ -1071,6 +1071,8 @@ int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
                 }
                 goto finish;
             }
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+                goto finish;
             // check if all outputs are solved by now
             if ( pPars->fSolveAll && p->vCexes && Vec_PtrCountZero(p->vCexes) == 0 )
                 goto finish;
@@ -123,6 +123,7 @@ struct Saig_ParBmc_t_
     int         fNoRestarts;    // disables periodic restarts
     int         fUseSatoko;     // enables using Satoko
     int         fUseGlucose;    // enables using Glucose 3.0
+    int         fUseCadical;    // enables using CaDiCaL
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
@@ -156,6 +157,7 @@ struct Bmc_AndPar_t_
     int         fUseOldCnf;     // use old CNF construction
     int         fUseGlucose;    // use Glucose 3.0 as the default solver
     int         fUseEliminate;  // use variable elimination
+    int         fSplitOuts;     // parallel solvers work on different outputs
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
@@ -164,6 +166,9 @@ struct Bmc_AndPar_t_
     int         nDropOuts;      // the number of dropped outputs
     
     void (*pFuncOnFrameDone)(int, int, int); // callback on each frame status (frame, po, statuss)
+    int         RunId;          // BMC id in this run 
+    int(*pFuncStop)(int);       // callback to terminate
+    void (*pFuncOnFrameDoneRun)(int, int, int, int); // callback on each frame status (run id, frame, po, status)
 };
   
 typedef struct Bmc_BCorePar_t_ Bmc_BCorePar_t;
@@ -370,6 +370,10 @@ int Bmcg_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 for ( k = 0; k < pPars->nFramesAdd; k++ )
                 for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
                     pPars->pFuncOnFrameDone(f+k, i, 0);
+            if( pPars->pFuncOnFrameDoneRun )
+                for ( k = 0; k < pPars->nFramesAdd; k++ )
+                for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
+                    pPars->pFuncOnFrameDoneRun(pPars->RunId, f+k, i, 0);
             continue;
         }
         nClauses += pCnf->nClauses;
@@ -378,6 +382,8 @@ int Bmcg_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
         for ( k = 0; k < pPars->nFramesAdd; k++ )
         {
+            if ( f+k < pPars->nStart ) // the outputs in the frames before the starting frame are not checked
+                continue;
             for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
             {
                 abctime clk = Abc_Clock();
@@ -385,6 +391,8 @@ int Bmcg_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
+                if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+                    break;
                 status = bmcg_sat_solver_solve( p->pSats[0], &iLit, 1 );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == -1 ) // unsat
@@ -393,6 +401,8 @@ int Bmcg_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                         Bmcg_ManPrintFrame( p, f+k, nClauses, -1, clkStart );
                     if( pPars->pFuncOnFrameDone)
                         pPars->pFuncOnFrameDone(f+k, i, 0);
+                    if( pPars->pFuncOnFrameDoneRun )
+                        pPars->pFuncOnFrameDoneRun(pPars->RunId, f+k, i, 0);
                     continue;
                 }
                 if ( status == 1 ) // sat
@@ -411,6 +421,8 @@ int Bmcg_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                     }
                     if( pPars->pFuncOnFrameDone )
                         pPars->pFuncOnFrameDone(f+k, i, 1);
+                    if( pPars->pFuncOnFrameDoneRun )
+                        pPars->pFuncOnFrameDoneRun(pPars->RunId, f+k, i, 1);
                 }
                 break;
             }
@@ -42,6 +42,7 @@
     #define bmc_sat_solver_solve               satoko_solve_assumptions
     #define bmc_sat_solver_read_cex_varvalue   satoko_read_cex_varvalue
     #define bmc_sat_solver_setstop             satoko_set_stop
+    #define bmc_sat_solver_read_units          satoko_read_units
 #endif
 
 
@@ -726,6 +727,7 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 #ifndef ABC_USE_PTHREADS
 
 int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs_ManPerformOne(pGia, pPars); }
+int Bmcs_ManPerformSplit( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs_ManPerformOne(pGia, pPars); }
 
 #else // pthreads are used
 
@@ -908,6 +910,277 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     return RetValue;
 }
 
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel solving of different outputs.]
+
+  Description [Instead of running all solvers on the same output, the
+  outputs of the newly unfolded frames are distributed among the solvers.
+  Each thread takes the next unsolved output, so the threads work on
+  disjoint outputs and, when several frames are unfolded at once (-A),
+  on disjoint frames. All solvers contain the same CNF of the unfolding.
+  The facts derived at the top level of one solver, including the negation
+  of each output proved unreachable, are shared with the other solvers
+  before they start solving their next output. The results are reported
+  in the same order as they are by the sequential engine.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Par_ThSplit_t_ Par_ThSplit_t;
+typedef struct Par_ShData_t_
+{
+    Par_ThSplit_t *  pThData;    // the threads
+    int              nThreads;   // the number of threads
+    pthread_mutex_t  Mutex;      // protects the data below
+    Vec_Int_t        vLits;      // output literals of the current frames
+    Vec_Int_t        vStatus;    // the status of each output
+    Vec_Int_t        vSolvers;   // the solver used for each output
+    int              iNext;      // the next output to be solved
+    int              iStop;      // the first output that is not proved
+    Vec_Int_t        vUnits;     // top-level literals shared by the solvers
+    Vec_Str_t        vShared;    // marks the variables with shared literals
+} Par_ShData_t;
+
+struct Par_ThSplit_t_
+{
+    bmc_sat_solver * pSat;
+    Par_ShData_t *   pShared;
+    Vec_Int_t        vImport;    // the units of other solvers to be added
+    int              iUnitRead;  // the number of shared units seen
+    int              nUnitSeen;  // the number of own units exported
+    int              iThread;
+    int              iItem;      // the output being solved
+    int              fWorking;
+    int              fStop;      // signal to stop the current solver call
+};
+
+static inline void Bmcs_ManShareUnits( Par_ShData_t * pSh, Par_ThSplit_t * pThData )
+{
+#ifndef ABC_USE_EXT_SOLVERS
+    int * pUnits, nUnits = bmc_sat_solver_read_units( pThData->pSat, &pUnits );
+    assert( pThData->nUnitSeen <= nUnits );
+    for ( ; pThData->nUnitSeen < nUnits; pThData->nUnitSeen++ )
+    {
+        int Lit = pUnits[pThData->nUnitSeen];
+        if ( Vec_StrEntry(&pSh->vShared, Abc_Lit2Var(Lit)) )
+            continue;
+        Vec_StrWriteEntry( &pSh->vShared, Abc_Lit2Var(Lit), 1 );
+        Vec_IntPush( &pSh->vUnits, Lit );
+    }
+#endif
+}
+void * Bmcs_ManWorkerThreadSplit( void * pArg )
+{
+    Par_ThSplit_t * pThData = (Par_ThSplit_t *)pArg;
+    Par_ShData_t * pSh = pThData->pShared;
+    volatile int * pPlace = &pThData->fWorking;
+    int i, k, iItem, iLit, status;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->pSat == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        while ( 1 )
+        {
+            // take the next output and collect the units derived by other solvers
+            pthread_mutex_lock( &pSh->Mutex );
+            iItem = pSh->iNext < pSh->iStop ? pSh->iNext++ : -1;
+            pThData->iItem = iItem;
+            Vec_IntClear( &pThData->vImport );
+            for ( ; pThData->iUnitRead < Vec_IntSize(&pSh->vUnits); pThData->iUnitRead++ )
+                Vec_IntPush( &pThData->vImport, Vec_IntEntry(&pSh->vUnits, pThData->iUnitRead) );
+            pthread_mutex_unlock( &pSh->Mutex );
+            if ( iItem == -1 )
+                break;
+            Vec_IntForEachEntry( &pThData->vImport, iLit, k )
+                bmc_sat_solver_addclause( pThData->pSat, &iLit, 1 );
+            // solve the output
+            iLit   = Vec_IntEntry( &pSh->vLits, iItem );
+            status = bmc_sat_solver_solve( pThData->pSat, &iLit, 1 );
+            if ( status == l_False )
+            {
+                iLit = Abc_LitNot( iLit );
+                bmc_sat_solver_addclause( pThData->pSat, &iLit, 1 );
+            }
+            // record the result
+            pthread_mutex_lock( &pSh->Mutex );
+            Vec_IntWriteEntry( &pSh->vStatus, iItem, status );
+            Vec_IntWriteEntry( &pSh->vSolvers, iItem, pThData->iThread );
+            if ( status != l_False && iItem < pSh->iStop )
+            {
+                // stop the solvers working on the later outputs
+                pSh->iStop = iItem;
+                for ( i = 0; i < pSh->nThreads; i++ )
+                    if ( pSh->pThData[i].iItem > iItem )
+                        pSh->pThData[i].fStop = 1;
+            }
+            Bmcs_ManShareUnits( pSh, pThData );
+            pthread_mutex_unlock( &pSh->Mutex );
+            if ( status != l_False )
+                break;
+        }
+        pThData->iItem = -1;
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+int Bmcs_ManPerformSplit( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    abctime clkStart = Abc_Clock();
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Par_ThSplit_t ThData[PAR_THR_MAX];
+    Par_ShData_t Shared, * pSh = &Shared;
+    Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
+    int f, k = 0, i = Gia_ManPoNum(pGia), n, status, RetValue = -1, nClauses = 0, Solver = 0;
+    int nPos = Gia_ManPoNum(pGia), nItems = nPos * pPars->nFramesAdd;
+    Abc_CexFreeP( &pGia->pCexSeq );
+    memset( pSh, 0, sizeof(Par_ShData_t) );
+    pSh->pThData  = ThData;
+    pSh->nThreads = pPars->nProcs;
+    pthread_mutex_init( &pSh->Mutex, NULL );
+    Vec_IntFill( &pSh->vLits,    nItems, -1 );
+    Vec_IntFill( &pSh->vStatus,  nItems, l_Undef );
+    Vec_IntFill( &pSh->vSolvers, nItems, -1 );
+    // start threads
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Par_ThSplit_t) );
+        ThData[i].pSat     = p->pSats[i];
+        ThData[i].pShared  = pSh;
+        ThData[i].iThread  = i;
+        ThData[i].iItem    = -1;
+        bmc_sat_solver_setstop( p->pSats[i], &ThData[i].fStop );
+        status = pthread_create( WorkerThread + i, NULL, Bmcs_ManWorkerThreadSplit, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // solve properties in each group of timeframes
+    for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
+    {
+        abctime clk;
+        Cnf_Dat_t * pCnf = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
+        if ( pCnf == NULL )
+        {
+            Bmcs_ManPrintFrame( p, f, nClauses, 0, clkStart );
+            if( pPars->pFuncOnFrameDone )
+                for ( k = 0; k < pPars->nFramesAdd; k++ )
+                for ( i = 0; i < nPos; i++ )
+                    pPars->pFuncOnFrameDone(f+k, i, 0);
+            continue;
+        }
+        // load CNF into solvers
+        nClauses += pCnf->nClauses;
+        for ( i = 0; i < pPars->nProcs; i++ )
+            Bmcs_ManAddCnf( p, p->pSats[i], pCnf );
+        p->nSatVarsOld = p->nSatVars;
+        Cnf_DataFree( pCnf );
+        Vec_StrFillExtra( &pSh->vShared, p->nSatVars, 0 );
+        // set up the outputs of these frames
+        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * nPos );
+        for ( n = 0; n < nItems; n++ )
+        {
+            int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, f * nPos + n) );
+            Vec_IntWriteEntry( &pSh->vLits, n, Abc_Var2Lit(Vec_IntEntry(&p->vFr2Sat, iObj), 0) );
+        }
+        Vec_IntFill( &pSh->vStatus,  nItems, l_Undef );
+        Vec_IntFill( &pSh->vSolvers, nItems, -1 );
+        pSh->iNext = 0;
+        pSh->iStop = nItems;
+        // solve the outputs and wait till the threads finish
+        clk = Abc_Clock();
+        for ( i = 0; i < pPars->nProcs; i++ )
+            ThData[i].fStop = 0, ThData[i].fWorking = 1;
+        for ( i = 0; i < pPars->nProcs; )
+        {
+            if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
+            {
+                pthread_mutex_lock( &pSh->Mutex );
+                pSh->iStop = pSh->iNext;
+                for ( n = 0; n < pPars->nProcs; n++ )
+                    ThData[n].fStop = 1;
+                pthread_mutex_unlock( &pSh->Mutex );
+            }
+            for ( i = 0; i < pPars->nProcs; i++ )
+                if ( *((volatile int *)&ThData[i].fWorking) )
+                    break;
+        }
+        p->timeSat += Abc_Clock() - clk;
+        // report the results in the order of outputs
+        for ( n = 0; n < nItems; n++ )
+        {
+            k = n / nPos;
+            i = n % nPos;
+            status = Vec_IntEntry( &pSh->vStatus, n );
+            Solver = Vec_IntEntry( &pSh->vSolvers, n );
+            if ( status == l_False ) // unsat
+            {
+                if ( i == nPos-1 )
+                    Bmcs_ManPrintFrame( p, f+k, nClauses, Solver, clkStart );
+                if( pPars->pFuncOnFrameDone )
+                    pPars->pFuncOnFrameDone(f+k, i, 0);
+                if ( i == nPos-1 && f+k == pPars->nFramesMax-1 )
+                    break;
+                continue;
+            }
+            if ( status == l_True ) // sat
+            {
+                RetValue = 0;
+                pPars->iFrame = f+k;
+                pGia->pCexSeq = Bmcs_ManGenerateCex( p, i, f+k, Solver );
+                pPars->nFailOuts++;
+                Bmcs_ManPrintFrame( p, f+k, nClauses, Solver, clkStart );
+                if ( !pPars->fNotVerbose )
+                {
+                    int nOutDigits = Abc_Base10Log( nPos );
+                    Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).  ",  
+                        nOutDigits, i, f+k, nOutDigits, pPars->nFailOuts, nOutDigits, nPos );
+                    fflush( stdout );
+                }
+                if( pPars->pFuncOnFrameDone )
+                    pPars->pFuncOnFrameDone(f+k, i, 1);
+            }
+            break;
+        }
+        if ( n < nItems )
+            break;
+        k = pPars->nFramesAdd;
+    }
+    // stop threads
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        assert( !ThData[i].fWorking );
+        ThData[i].pSat = NULL;
+        ThData[i].fWorking = 1;
+    }
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        pthread_join( WorkerThread[i], NULL );
+        Vec_IntErase( &ThData[i].vImport );
+    }
+    pthread_mutex_destroy( &pSh->Mutex );
+    Vec_IntErase( &pSh->vLits );
+    Vec_IntErase( &pSh->vStatus );
+    Vec_IntErase( &pSh->vSolvers );
+    Vec_IntErase( &pSh->vUnits );
+    Vec_StrErase( &pSh->vShared );
+    p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
+    if ( RetValue == -1 && !pPars->fNotVerbose )
+        printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    Bmcs_ManPrintTime( p );
+    Bmcs_ManStop( p );
+    return RetValue;
+}
+
 #endif // pthreads are used
 
 
@@ -927,6 +1200,8 @@ int Bmcs_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     assert( pPars->nProcs < PAR_THR_MAX );
     if ( pPars->nProcs == 1 )
         return Bmcs_ManPerformOne( pGia, pPars );
+    else if ( pPars->fSplitOuts )
+        return Bmcs_ManPerformSplit( pGia, pPars );
     else
         return Bmcs_ManPerformMulti( pGia, pPars );
 }
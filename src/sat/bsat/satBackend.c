@@ -0,0 +1,292 @@
+/**CFile****************************************************************
+
+  FileName    [satBackend.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [C-language MiniSat solver.]
+
+  Synopsis    [Uniform interface to the incremental SAT solvers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: satBackend.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "satBackend.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose/AbcGlucose.h"
+#include "sat/cadical/cadicalSolver.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+const char * sat_backend_name( int Type )
+{
+    if ( Type == SAT_BACKEND_BSAT )    return "bsat";
+    if ( Type == SAT_BACKEND_SATOKO )  return "satoko";
+    if ( Type == SAT_BACKEND_GLUCOSE ) return "glucose";
+    if ( Type == SAT_BACKEND_CADICAL ) return "cadical";
+    return NULL;
+}
+sat_backend * sat_backend_start( int Type )
+{
+    sat_backend * s = ABC_CALLOC( sat_backend, 1 );
+    s->Type = Type;
+    switch ( Type )
+    {
+    case SAT_BACKEND_BSAT:    s->pSolver = sat_solver_new();         break;
+    case SAT_BACKEND_SATOKO:  s->pSolver = satoko_create();          break;
+    case SAT_BACKEND_GLUCOSE: s->pSolver = bmcg_sat_solver_start();  break;
+    case SAT_BACKEND_CADICAL: s->pSolver = cadical_solver_new();     break;
+    default: assert( 0 );
+    }
+    return s;
+}
+void sat_backend_stop( sat_backend * s )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    sat_solver_delete( (sat_solver *)s->pSolver );          break;
+    case SAT_BACKEND_SATOKO:  satoko_destroy( (satoko_t *)s->pSolver );               break;
+    case SAT_BACKEND_GLUCOSE: bmcg_sat_solver_stop( (bmcg_sat_solver *)s->pSolver );  break;
+    case SAT_BACKEND_CADICAL: cadical_solver_delete( (cadical_solver *)s->pSolver );  break;
+    }
+    ABC_FREE( s );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Manipulates the variables.]
+
+  Description [Procedure sat_backend_setnvars() makes sure the solver
+  has at least the given number of variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int sat_backend_varnum( sat_backend * s )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    return sat_solver_nvars( (sat_solver *)s->pSolver );
+    case SAT_BACKEND_SATOKO:  return satoko_varnum( (satoko_t *)s->pSolver );
+    case SAT_BACKEND_GLUCOSE: return bmcg_sat_solver_varnum( (bmcg_sat_solver *)s->pSolver );
+    case SAT_BACKEND_CADICAL: return cadical_solver_nvars( (cadical_solver *)s->pSolver );
+    }
+    return 0;
+}
+void sat_backend_setnvars( sat_backend * s, int nVars )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    sat_solver_setnvars( (sat_solver *)s->pSolver, nVars );  break;
+    case SAT_BACKEND_SATOKO:  satoko_setnvars( (satoko_t *)s->pSolver, nVars );        break;
+    case SAT_BACKEND_GLUCOSE:
+        while ( bmcg_sat_solver_varnum( (bmcg_sat_solver *)s->pSolver ) < nVars )
+            bmcg_sat_solver_addvar( (bmcg_sat_solver *)s->pSolver );
+        break;
+    case SAT_BACKEND_CADICAL:
+        if ( cadical_solver_nvars( (cadical_solver *)s->pSolver ) < nVars )
+            cadical_solver_setnvars( (cadical_solver *)s->pSolver, nVars );
+        break;
+    }
+}
+int sat_backend_addvar( sat_backend * s )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    return sat_solver_addvar( (sat_solver *)s->pSolver );
+    case SAT_BACKEND_SATOKO:  return satoko_add_variable( (satoko_t *)s->pSolver, 0 );
+    case SAT_BACKEND_GLUCOSE: return bmcg_sat_solver_addvar( (bmcg_sat_solver *)s->pSolver );
+    case SAT_BACKEND_CADICAL: return cadical_solver_addvar( (cadical_solver *)s->pSolver );
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds clauses.]
+
+  Description [Returns 0 if the problem became trivially UNSAT.
+  Procedure sat_backend_addcnf() loads all clauses of the CNF.]
+
+  SideEffects [The bsat solver may reorder the literals of the clause.]
+
+  SeeAlso     []
+
+***********************************************************************/
+int sat_backend_addclause( sat_backend * s, int * pLits, int nLits )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    return sat_solver_addclause( (sat_solver *)s->pSolver, pLits, pLits + nLits );
+    case SAT_BACKEND_SATOKO:  return satoko_add_clause( (satoko_t *)s->pSolver, pLits, nLits );
+    case SAT_BACKEND_GLUCOSE: return bmcg_sat_solver_addclause( (bmcg_sat_solver *)s->pSolver, pLits, nLits );
+    case SAT_BACKEND_CADICAL: return cadical_solver_addclause( (cadical_solver *)s->pSolver, pLits, pLits + nLits );
+    }
+    return 0;
+}
+int sat_backend_addcnf( sat_backend * s, Cnf_Dat_t * pCnf )
+{
+    int i;
+    sat_backend_setnvars( s, pCnf->nVars );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        if ( !sat_backend_addclause( s, pCnf->pClauses[i], pCnf->pClauses[i+1] - pCnf->pClauses[i] ) )
+            return 0;
+    if ( s->Type == SAT_BACKEND_BSAT )
+        return sat_solver_simplify( (sat_solver *)s->pSolver );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under assumptions.]
+
+  Description [Returns l_True, l_False, or l_Undef. The conflict limit
+  applies to this call only (0 means no limit).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int sat_backend_solve( sat_backend * s, int * pLits, int nLits, int nConfLimit )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:
+        return sat_solver_solve( (sat_solver *)s->pSolver, pLits, pLits + nLits, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    case SAT_BACKEND_SATOKO:
+        return satoko_solve_assumptions_limit( (satoko_t *)s->pSolver, pLits, nLits, nConfLimit );
+    case SAT_BACKEND_GLUCOSE:
+        bmcg_sat_solver_set_conflict_budget( (bmcg_sat_solver *)s->pSolver, nConfLimit );
+        return bmcg_sat_solver_solve( (bmcg_sat_solver *)s->pSolver, pLits, nLits );
+    case SAT_BACKEND_CADICAL:
+        return cadical_solver_solve( (cadical_solver *)s->pSolver, pLits, pLits + nLits, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    }
+    return l_Undef;
+}
+abctime sat_backend_set_runtime_limit( sat_backend * s, abctime Limit )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    return sat_solver_set_runtime_limit( (sat_solver *)s->pSolver, Limit );
+    case SAT_BACKEND_SATOKO:  return satoko_set_runtime_limit( (satoko_t *)s->pSolver, Limit );
+    case SAT_BACKEND_GLUCOSE: return bmcg_sat_solver_set_runtime_limit( (bmcg_sat_solver *)s->pSolver, Limit );
+    case SAT_BACKEND_CADICAL: return cadical_solver_set_runtime_limit( (cadical_solver *)s->pSolver, Limit );
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the results of the last call.]
+
+  Description [Procedure sat_backend_final() returns the assumptions
+  responsible for the UNSAT result, complemented.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int sat_backend_final( sat_backend * s, int ** ppLits )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    return sat_solver_final( (sat_solver *)s->pSolver, ppLits );
+    case SAT_BACKEND_SATOKO:  return satoko_final_conflict( (satoko_t *)s->pSolver, ppLits );
+    case SAT_BACKEND_GLUCOSE: return bmcg_sat_solver_final( (bmcg_sat_solver *)s->pSolver, ppLits );
+    case SAT_BACKEND_CADICAL: return cadical_solver_final( (cadical_solver *)s->pSolver, ppLits );
+    }
+    return 0;
+}
+int sat_backend_read_cex_varvalue( sat_backend * s, int iVar )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    return sat_solver_var_value( (sat_solver *)s->pSolver, iVar );
+    case SAT_BACKEND_SATOKO:  return satoko_read_cex_varvalue( (satoko_t *)s->pSolver, iVar );
+    case SAT_BACKEND_GLUCOSE: return bmcg_sat_solver_read_cex_varvalue( (bmcg_sat_solver *)s->pSolver, iVar );
+    case SAT_BACKEND_CADICAL: return cadical_solver_get_var_value( (cadical_solver *)s->pSolver, iVar );
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the solver statistics.]
+
+  Description [The statistics of CaDiCaL are not available through its
+  C interface, so zeros are returned.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int sat_backend_clausenum( sat_backend * s )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    return sat_solver_nclauses( (sat_solver *)s->pSolver );
+    case SAT_BACKEND_SATOKO:  return satoko_clausenum( (satoko_t *)s->pSolver );
+    case SAT_BACKEND_GLUCOSE: return bmcg_sat_solver_clausenum( (bmcg_sat_solver *)s->pSolver );
+    }
+    return 0;
+}
+int sat_backend_learntnum( sat_backend * s )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    return (int)((sat_solver *)s->pSolver)->stats.learnts;
+    case SAT_BACKEND_SATOKO:  return satoko_learntnum( (satoko_t *)s->pSolver );
+    case SAT_BACKEND_GLUCOSE: return bmcg_sat_solver_learntnum( (bmcg_sat_solver *)s->pSolver );
+    }
+    return 0;
+}
+int sat_backend_conflictnum( sat_backend * s )
+{
+    switch ( s->Type )
+    {
+    case SAT_BACKEND_BSAT:    return sat_solver_nconflicts( (sat_solver *)s->pSolver );
+    case SAT_BACKEND_SATOKO:  return satoko_conflictnum( (satoko_t *)s->pSolver );
+    case SAT_BACKEND_GLUCOSE: return bmcg_sat_solver_conflictnum( (bmcg_sat_solver *)s->pSolver );
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,99 @@
+/**CFile****************************************************************
+
+  FileName    [satBackend.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [C-language MiniSat solver.]
+
+  Synopsis    [Uniform interface to the incremental SAT solvers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: satBackend.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__sat__bsat__satBackend_h
+#define ABC__sat__bsat__satBackend_h
+
+/*
+    The engines that solve a sequence of related problems (CEC, BMC)
+    need the same handful of operations from a SAT solver: adding
+    variables and clauses, solving under assumptions with a conflict
+    limit, reading the model and the final conflict in terms of the
+    assumptions. This file declares them for the incremental solvers
+    available in ABC, so that an engine can select the solver at runtime.
+    Each call is one switch on the solver type, which is negligible
+    compared to the work done inside the solver.
+
+    Literals follow the ABC convention (2*Var + Compl); the values
+    returned by sat_backend_solve() are l_True, l_False, and l_Undef.
+    Kissat is not included because it does not support assumptions.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "satSolver.h"
+#include "sat/cnf/cnf.h"
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+typedef enum {
+    SAT_BACKEND_BSAT = 0,            // 0: MiniSat-based solver in src/sat/bsat
+    SAT_BACKEND_SATOKO,              // 1: Satoko by Bruno Schmitt
+    SAT_BACKEND_GLUCOSE,             // 2: Glucose 3.0 by Gilles Audemard and Laurent Simon
+    SAT_BACKEND_CADICAL,             // 3: CaDiCaL by Armin Biere
+    SAT_BACKEND_NUM                  // 4: the number of backends
+} Sat_Backend_t;
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct sat_backend_ sat_backend;
+struct sat_backend_
+{
+    int              Type;           // the solver used (Sat_Backend_t)
+    void *           pSolver;        // the solver
+};
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== satBackend.c ==========================================================*/
+extern const char *  sat_backend_name( int Type );
+extern sat_backend * sat_backend_start( int Type );
+extern void          sat_backend_stop( sat_backend * s );
+extern int           sat_backend_varnum( sat_backend * s );
+extern void          sat_backend_setnvars( sat_backend * s, int nVars );
+extern int           sat_backend_addvar( sat_backend * s );
+extern int           sat_backend_addclause( sat_backend * s, int * pLits, int nLits );
+extern int           sat_backend_addcnf( sat_backend * s, Cnf_Dat_t * pCnf );
+extern int           sat_backend_solve( sat_backend * s, int * pLits, int nLits, int nConfLimit );
+extern int           sat_backend_final( sat_backend * s, int ** ppLits );
+extern int           sat_backend_read_cex_varvalue( sat_backend * s, int iVar );
+extern abctime       sat_backend_set_runtime_limit( sat_backend * s, abctime Limit );
+extern int           sat_backend_clausenum( sat_backend * s );
+extern int           sat_backend_learntnum( sat_backend * s );
+extern int           sat_backend_conflictnum( sat_backend * s );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
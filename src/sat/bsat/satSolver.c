@@ -133,6 +133,14 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// the watcher lists contain two kinds of entries:
+// - a 2-literal clause is one odd entry (clause_from_lit() of the other literal)
+// - a longer clause is two entries: its (even) handle followed by the blocker,
+//   a literal of the clause whose being true means the clause can be skipped
+//   without reading it from memory
+static inline int      sat_solver_watch_size(cla h)                { return clause_is_lit(h) ? 1 : 2; }
+static inline void     sat_solver_watch_push(veci* ws, cla h, lit blocker) { veci_push(ws, h); veci_push(ws, blocker); }
+
 //=================================================================================================
 // Variable order functions:
 
@@ -587,8 +595,16 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size == 2 )
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
+    }
+    else // the other watched literal is the initial blocker
+    {
+        sat_solver_watch_push(sat_solver_read_wlist(s,lit_neg(begin[0])),h,begin[1]);
+        sat_solver_watch_push(sat_solver_read_wlist(s,lit_neg(begin[1])),h,begin[0]);
+    }
 
     return h;
 }
@@ -1077,9 +1093,21 @@ int sat_solver_propagate(sat_solver* s)
                     while (i < end)
                         *j++ = *i++;
                 }
+                else
+                    i++;
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                lit blocker = i[1];
+
+                // If the blocker is true, then clause is already satisfied.
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1091,8 +1119,11 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (lits[0] != blocker && var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                    i += 2;
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1101,24 +1132,27 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_watch_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i,lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
                         while (i < end)
                             *j++ = *i++;
+                        break;
                     }
+                next:
+                    i += 2;
                 }
             }
-        next:
-            i++;
         }
 
         s->stats.inspects += j - veci_begin(ws);
@@ -1608,17 +1642,23 @@ void sat_solver_reducedb(sat_solver* s)
     for ( i = 0; i < s->size*2; i++ )
     {
         pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += sat_solver_watch_size(pArray[k]) )
         {
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
             else 
             {
                 c = clause_read(s, pArray[k]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k+1];
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1672,7 +1712,7 @@ void sat_solver_rollback( sat_solver* s )
     for ( i = 0; i < s->iVarPivot*2; i++ )
     {
         cla* pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += sat_solver_watch_size(pArray[k]) )
         {
             if ( clause_is_lit(pArray[k]) )
             {
@@ -1680,7 +1720,10 @@ void sat_solver_rollback( sat_solver* s )
                     pArray[j++] = pArray[k];
             }
             else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
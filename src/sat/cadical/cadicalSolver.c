@@ -48,6 +48,7 @@ cadical_solver* cadical_solver_new(void) {
   s->nVars = 0;
   s->vAssumptions = NULL;
   s->vCore = NULL;
+  s->nRuntimeLimit = 0;
   return s;
 }
 
@@ -252,6 +253,30 @@ int cadical_solver_get_var_value(cadical_solver* s, int v) {
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [set runtime limit]
+
+  Description [the limit is checked by the terminator of cadical, which
+               is connected only while the limit is set. returns the
+               previous limit.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int cadical_solver_terminate(void* p) {
+  cadical_solver* s = (cadical_solver*)p;
+  return s->nRuntimeLimit && Abc_Clock() > s->nRuntimeLimit;
+}
+abctime cadical_solver_set_runtime_limit(cadical_solver* s, abctime Limit) {
+  abctime nRuntimeLimit = s->nRuntimeLimit;
+  s->nRuntimeLimit = Limit;
+  ccadical_set_terminate((CCaDiCaL*)s->p, Limit ? (void*)s : NULL, Limit ? cadical_solver_terminate : NULL);
+  return nRuntimeLimit;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Solves the given CNF using cadical.]
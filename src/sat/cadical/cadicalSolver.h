@@ -45,6 +45,7 @@ struct cadical_solver_
   int nVars;
   Vec_Int_t* vAssumptions;
   Vec_Int_t* vCore;
+  abctime nRuntimeLimit;
 };
 
 
@@ -65,6 +66,7 @@ extern int              cadical_solver_nvars(cadical_solver* s);
 extern int              cadical_solver_addvar(cadical_solver* s);
 extern void             cadical_solver_setnvars(cadical_solver* s,int n);
 extern int              cadical_solver_get_var_value(cadical_solver* s, int v);
+extern abctime          cadical_solver_set_runtime_limit(cadical_solver* s, abctime Limit);
 extern Vec_Int_t *      cadical_solve_cnf( Cnf_Dat_t * pCnf, char * pArgs, int nConfs, int nTimeLimit, int fSat, int fUnsat, int fPrintCex, int fVerbose );
 
 ABC_NAMESPACE_HEADER_END
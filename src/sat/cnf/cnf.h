@@ -52,6 +52,9 @@ typedef struct Cnf_Man_t_            Cnf_Man_t;
 typedef struct Cnf_Dat_t_            Cnf_Dat_t;
 typedef struct Cnf_Cut_t_            Cnf_Cut_t;
 
+// the callback receiving the streamed clauses (returns 0 to stop streaming)
+typedef int (*Cnf_ClauseFunc_t)( void * pData, Cnf_Dat_t * pCnf, int * pBeg, int * pEnd );
+
 // the CNF asserting outputs of AIG to be 1
 struct Cnf_Dat_t_
 {
@@ -88,6 +91,7 @@ struct Cnf_Man_t_
     int             nMergeLimit;     // the limit on the size of merged cut
     unsigned *      pTruths[4];      // temporary truth tables
     Vec_Int_t *     vMemory;         // memory for intermediate ISOP representation
+    int             nThreads;        // the number of threads used to derive CNF
     abctime         timeCuts; 
     abctime         timeMap;
     abctime         timeSave;
@@ -129,11 +133,14 @@ static inline void         Cnf_ObjSetBestCut( Aig_Obj_t * pObj, Cnf_Cut_t * pCut
 extern Vec_Int_t *     Cnf_DeriveMappingArray( Aig_Man_t * pAig );
 extern Cnf_Dat_t *     Cnf_Derive( Aig_Man_t * pAig, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs );
+extern Cnf_Dat_t *     Cnf_DeriveStream( Aig_Man_t * pAig, int nOutputs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pData );
+extern Cnf_Dat_t *     Cnf_DeriveStreamWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pData );
 extern Cnf_Dat_t *     Cnf_DeriveOther( Aig_Man_t * pAig, int fSkipTtMin );
 extern Cnf_Dat_t *     Cnf_DeriveOtherWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTtMin );
 extern void            Cnf_ManPrepare();
 extern Cnf_Man_t *     Cnf_ManRead();
 extern void            Cnf_ManFree();
+extern void            Cnf_ManSetThreadNum( int nThreads );
 /*=== cnfCut.c ========================================================*/
 extern Cnf_Cut_t *     Cnf_CutCreate( Cnf_Man_t * p, Aig_Obj_t * pObj );
 extern void            Cnf_CutPrint( Cnf_Cut_t * pCut );
@@ -165,12 +172,15 @@ extern void            Cnf_DataWriteIntoFile( Cnf_Dat_t * p, char * pFileName, i
 extern void            Cnf_DataWriteIntoFileInv( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vExists1, Vec_Int_t * vForAlls, Vec_Int_t * vExists2 );
 extern void *          Cnf_DataWriteIntoSolver( Cnf_Dat_t * p, int nFrames, int fInit );
 extern void *          Cnf_DataWriteIntoSolverInt( void * pSat, Cnf_Dat_t * p, int nFrames, int fInit );
+extern void *          Cnf_DeriveIntoSolver( Aig_Man_t * pAig, int nOutputs, int fChangePol, Cnf_Dat_t ** ppCnf );
+extern Cnf_Dat_t *     Cnf_DeriveIntoFile( Aig_Man_t * pAig, int nOutputs, int fChangePol, char * pFileName );
 extern int             Cnf_DataWriteOrClause( void * pSat, Cnf_Dat_t * pCnf );
 extern int             Cnf_DataWriteAndClauses( void * p, Cnf_Dat_t * pCnf );
 extern void            Cnf_DataTranformPolarity( Cnf_Dat_t * pCnf, int fTransformPos );
 extern int             Cnf_DataAddXorClause( void * pSat, int iVarA, int iVarB, int iVarC );
 /*=== cnfMap.c ========================================================*/
 extern void            Cnf_DeriveMapping( Cnf_Man_t * p );
+extern void            Cnf_DeriveMappingPar( Cnf_Man_t * p );
 extern int             Cnf_ManMapForCnf( Cnf_Man_t * p );
 /*=== cnfPost.c ========================================================*/
 extern void            Cnf_ManTransferCuts( Cnf_Man_t * p );
@@ -187,6 +197,7 @@ extern Cnf_Dat_t *     Cnf_DataReadFromFile( char * pFileName );
 extern Vec_Int_t *     Cnf_ManWriteCnfMapping( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern void            Cnf_SopConvertToVector( char * pSop, int nCubes, Vec_Int_t * vCover );
 extern Cnf_Dat_t *     Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs );
+extern Cnf_Dat_t *     Cnf_ManWriteCnfStream( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pData );
 extern Cnf_Dat_t *     Cnf_ManWriteCnfOther( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern Cnf_Dat_t *     Cnf_DeriveSimple( Aig_Man_t * p, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveSimpleForRetiming( Aig_Man_t * p );
@@ -62,6 +62,11 @@ void Cnf_ManFree()
     Cnf_ManStop( s_pManCnf );
     s_pManCnf = NULL;
 }
+void Cnf_ManSetThreadNum( int nThreads )
+{
+    Cnf_ManPrepare();
+    s_pManCnf->nThreads = Abc_MaxInt( 1, nThreads );
+}
 
 
 /**Function*************************************************************
@@ -80,7 +85,7 @@ Vec_Int_t * Cnf_DeriveMappingArray( Aig_Man_t * pAig )
     Vec_Int_t * vResult;
     Cnf_Man_t * p;
     Vec_Ptr_t * vMapped;
-    Aig_MmFixed_t * pMemCuts;
+    Vec_Ptr_t * vMemCuts;
     abctime clk;
     // allocate the CNF manager
     p = Cnf_ManStart();
@@ -88,7 +93,7 @@ Vec_Int_t * Cnf_DeriveMappingArray( Aig_Man_t * pAig )
 
     // generate cuts for all nodes, assign cost, and find best cuts
 clk = Abc_Clock();
-    pMemCuts = Dar_ManComputeCuts( pAig, 10, 0, 0 );
+    vMemCuts = Dar_ManComputeCutsPar( pAig, 10, 0, p->nThreads, 0 );
 p->timeCuts = Abc_Clock() - clk;
 
     // find the mapping
@@ -103,7 +108,7 @@ clk = Abc_Clock();
     vMapped = Cnf_ManScanMapping( p, 1, 0 );
     vResult = Cnf_ManWriteCnfMapping( p, vMapped );
     Vec_PtrFree( vMapped );
-    Aig_MmFixedStop( pMemCuts, 0 );
+    Dar_ManStopCutsPar( vMemCuts );
 p->timeSave = Abc_Clock() - clk;
 
    // reset reference counters
@@ -130,14 +135,14 @@ Cnf_Dat_t * Cnf_DeriveWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs )
 {
     Cnf_Dat_t * pCnf;
     Vec_Ptr_t * vMapped;
-    Aig_MmFixed_t * pMemCuts;
+    Vec_Ptr_t * vMemCuts;
     abctime clk;
     // connect the managers
     p->pManAig = pAig;
 
     // generate cuts for all nodes, assign cost, and find best cuts
 clk = Abc_Clock();
-    pMemCuts = Dar_ManComputeCuts( pAig, 10, 0, 0 );
+    vMemCuts = Dar_ManComputeCutsPar( pAig, 10, 0, p->nThreads, 0 );
 p->timeCuts = Abc_Clock() - clk;
 
     // find the mapping
@@ -152,7 +157,7 @@ clk = Abc_Clock();
     vMapped = Cnf_ManScanMapping( p, 1, 1 );
     pCnf = Cnf_ManWriteCnf( p, vMapped, nOutputs );
     Vec_PtrFree( vMapped );
-    Aig_MmFixedStop( pMemCuts, 0 );
+    Dar_ManStopCutsPar( vMemCuts );
 p->timeSave = Abc_Clock() - clk;
 
    // reset reference counters
@@ -168,6 +173,59 @@ Cnf_Dat_t * Cnf_Derive( Aig_Man_t * pAig, int nOutputs )
     return Cnf_DeriveWithMan( s_pManCnf, pAig, nOutputs );
 }
  
+/**Function*************************************************************
+
+  Synopsis    [Converts AIG into CNF passing clauses to the callback.]
+
+  Description [Performs the same mapping as Cnf_DeriveWithMan() but does
+  not collect the clauses. Each clause is handed to the callback as soon 
+  as it is derived, so the memory for the clause array is not needed.
+  Returns the CNF with the variable map but without clauses.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_DeriveStreamWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pData )
+{
+    Cnf_Dat_t * pCnf;
+    Vec_Ptr_t * vMapped;
+    Vec_Ptr_t * vMemCuts;
+    abctime clk;
+    // connect the managers
+    p->pManAig = pAig;
+
+    // generate cuts for all nodes, assign cost, and find best cuts
+clk = Abc_Clock();
+    vMemCuts = Dar_ManComputeCutsPar( pAig, 10, 0, p->nThreads, 0 );
+p->timeCuts = Abc_Clock() - clk;
+
+    // find the mapping
+clk = Abc_Clock();
+    Cnf_DeriveMapping( p );
+p->timeMap = Abc_Clock() - clk;
+
+    // convert it into CNF
+clk = Abc_Clock();
+    Cnf_ManTransferCuts( p );
+    // the best cuts are copied, so the cut memory can be reused by the consumer
+    Dar_ManStopCutsPar( vMemCuts );
+    vMapped = Cnf_ManScanMapping( p, 1, 1 );
+    pCnf = Cnf_ManWriteCnfStream( p, vMapped, nOutputs, fChangePol, pFunc, pData );
+    Vec_PtrFree( vMapped );
+p->timeSave = Abc_Clock() - clk;
+
+   // reset reference counters
+    Aig_ManResetRefs( pAig );
+    return pCnf;
+}
+Cnf_Dat_t * Cnf_DeriveStream( Aig_Man_t * pAig, int nOutputs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pData )
+{
+    Cnf_ManPrepare();
+    return Cnf_DeriveStreamWithMan( s_pManCnf, pAig, nOutputs, fChangePol, pFunc, pData );
+}
+ 
 /**Function*************************************************************
 
   Synopsis    [Converts AIG into the SAT solver.]
@@ -60,6 +60,7 @@ Cnf_Man_t * Cnf_ManStart()
     // allocate memory manager for cuts
     p->pMemCuts = Aig_MmFlexStart();
     p->nMergeLimit = 10;
+    p->nThreads = 1;
     // allocate temporary truth tables
     p->pTruths[0] = ABC_ALLOC( unsigned, 4 * Abc_TruthWordNum(p->nMergeLimit) );
     for ( i = 1; i < 4; i++ )
@@ -212,7 +213,8 @@ void Cnf_DataFree( Cnf_Dat_t * p )
     ABC_FREE( p->pClaPols );
     ABC_FREE( p->pObj2Clause );
     ABC_FREE( p->pObj2Count );
-    ABC_FREE( p->pClauses[0] );
+    if ( p->pClauses )
+        ABC_FREE( p->pClauses[0] );
     ABC_FREE( p->pClauses );
     ABC_FREE( p->pVarNums );
     ABC_FREE( p );
@@ -581,6 +583,98 @@ void * Cnf_DataWriteIntoSolver( Cnf_Dat_t * p, int nFrames, int fInit )
     return Cnf_DataWriteIntoSolverInt( sat_solver_new(), p, nFrames, fInit );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF of the AIG directly into the SAT solver.]
+
+  Description [Has the same effect as Cnf_Derive() followed by 
+  Cnf_DataWriteIntoSolver() with one frame, but the clauses are loaded
+  into the solver as they are derived and the clause array is never
+  created. Returns NULL if the problem is trivially UNSAT. Otherwise,
+  returns the solver and, if ppCnf is not NULL, the CNF with the variable
+  map (without clauses).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_DeriveIntoSolverAdd( void * pData, Cnf_Dat_t * pCnf, int * pBeg, int * pEnd )
+{
+    sat_solver * pSat = (sat_solver *)pData;
+    if ( sat_solver_nvars(pSat) < pCnf->nVars )
+        sat_solver_setnvars( pSat, pCnf->nVars );
+    return sat_solver_addclause( pSat, pBeg, pEnd );
+}
+void * Cnf_DeriveIntoSolver( Aig_Man_t * pAig, int nOutputs, int fChangePol, Cnf_Dat_t ** ppCnf )
+{
+    sat_solver * pSat = sat_solver_new();
+    Cnf_Dat_t * pCnf = Cnf_DeriveStream( pAig, nOutputs, fChangePol, Cnf_DeriveIntoSolverAdd, pSat );
+    if ( ppCnf )
+        *ppCnf = NULL;
+    if ( pCnf == NULL || !sat_solver_simplify(pSat) )
+    {
+        Cnf_DataFree( pCnf );
+        sat_solver_delete( pSat );
+        return NULL;
+    }
+    if ( ppCnf )
+        *ppCnf = pCnf;
+    else
+        Cnf_DataFree( pCnf );
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF of the AIG directly into a file.]
+
+  Description [Writes the same file as Cnf_Derive() followed by
+  Cnf_DataWriteIntoFile(), but each clause is printed as soon as it is
+  derived. Returns the CNF with the variable map (without clauses) or
+  NULL if the file cannot be opened.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cnf_FileOut_t_ Cnf_FileOut_t;
+struct Cnf_FileOut_t_
+{
+    FILE *          pFile;           // the output file
+    int             nClauses;        // the number of clauses written
+};
+static int Cnf_DeriveIntoFileAdd( void * pData, Cnf_Dat_t * pCnf, int * pBeg, int * pEnd )
+{
+    Cnf_FileOut_t * p = (Cnf_FileOut_t *)pData;
+    if ( p->nClauses++ == 0 )
+    {
+        fprintf( p->pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+        fprintf( p->pFile, "p cnf %d %d\n", pCnf->nVars, pCnf->nClauses );
+    }
+    for ( ; pBeg < pEnd; pBeg++ )
+        fprintf( p->pFile, "%d ", Cnf_Lit2Var(*pBeg) );
+    fprintf( p->pFile, "0\n" );
+    return 1;
+}
+Cnf_Dat_t * Cnf_DeriveIntoFile( Aig_Man_t * pAig, int nOutputs, int fChangePol, char * pFileName )
+{
+    Cnf_FileOut_t Out = { NULL, 0 };
+    Cnf_Dat_t * pCnf;
+    Out.pFile = fopen( pFileName, "w" );
+    if ( Out.pFile == NULL )
+    {
+        printf( "Cnf_DeriveIntoFile(): Output file cannot be opened.\n" );
+        return NULL;
+    }
+    pCnf = Cnf_DeriveStream( pAig, nOutputs, fChangePol, Cnf_DeriveIntoFileAdd, &Out );
+    assert( Out.nClauses == pCnf->nClauses );
+    fprintf( Out.pFile, "\n" );
+    fclose( Out.pFile );
+    return pCnf;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes CNF into a file.]
@@ -97,48 +97,53 @@ int Cnf_CutSuperAreaFlow( Vec_Ptr_t * vSuper, int * pAreaFlows )
   SeeAlso     []
 
 ***********************************************************************/
+static inline void Cnf_DeriveMappingNode( Cnf_Man_t * p, Aig_Obj_t * pObj, int * pAreaFlows )
+{
+    Dar_Cut_t * pCut, * pCutBest;
+    int k, AreaFlow;
+    // go through the cuts
+    pCutBest = NULL;
+    Dar_ObjForEachCut( pObj, pCut, k )
+    {
+        pCut->fBest = 0;
+        if ( k == 0 )
+            continue;
+        Cnf_CutAssignAreaFlow( p, pCut, pAreaFlows );
+        if ( pCutBest == NULL || pCutBest->uSign > pCut->uSign || 
+            (pCutBest->uSign == pCut->uSign && pCutBest->Value < pCut->Value) )
+             pCutBest = pCut;
+    }
+    // check the big cut
+//    Aig_ObjCollectSuper( pObj, vSuper );
+    // get the area flow of this cut
+//    AreaFlow = Cnf_CutSuperAreaFlow( vSuper, pAreaFlows );
+    AreaFlow = ABC_INFINITY;
+    if ( AreaFlow >= (int)pCutBest->uSign )
+    {
+        pAreaFlows[pObj->Id] = pCutBest->uSign;
+        pCutBest->fBest = 1;
+    }
+    else
+    {
+        pAreaFlows[pObj->Id] = AreaFlow;
+        pObj->fMarkB = 1; // mark the special node
+    }
+}
 void Cnf_DeriveMapping( Cnf_Man_t * p )
 {
-    Vec_Ptr_t * vSuper;
     Aig_Obj_t * pObj;
-    Dar_Cut_t * pCut, * pCutBest;
-    int i, k, AreaFlow, * pAreaFlows;
+    int i, * pAreaFlows;
+    if ( p->nThreads > 1 )
+    {
+        Cnf_DeriveMappingPar( p );
+        return;
+    }
     // allocate area flows
     pAreaFlows = ABC_ALLOC( int, Aig_ManObjNumMax(p->pManAig) );
     memset( pAreaFlows, 0, sizeof(int) * Aig_ManObjNumMax(p->pManAig) );
     // visit the nodes in the topological order and update their best cuts
-    vSuper = Vec_PtrAlloc( 100 );
     Aig_ManForEachNode( p->pManAig, pObj, i )
-    {
-        // go through the cuts
-        pCutBest = NULL;
-        Dar_ObjForEachCut( pObj, pCut, k )
-        {
-            pCut->fBest = 0;
-            if ( k == 0 )
-                continue;
-            Cnf_CutAssignAreaFlow( p, pCut, pAreaFlows );
-            if ( pCutBest == NULL || pCutBest->uSign > pCut->uSign || 
-                (pCutBest->uSign == pCut->uSign && pCutBest->Value < pCut->Value) )
-                 pCutBest = pCut;
-        }
-        // check the big cut
-//        Aig_ObjCollectSuper( pObj, vSuper );
-        // get the area flow of this cut
-//        AreaFlow = Cnf_CutSuperAreaFlow( vSuper, pAreaFlows );
-        AreaFlow = ABC_INFINITY;
-        if ( AreaFlow >= (int)pCutBest->uSign )
-        {
-            pAreaFlows[pObj->Id] = pCutBest->uSign;
-            pCutBest->fBest = 1;
-        }
-        else
-        {
-            pAreaFlows[pObj->Id] = AreaFlow;
-            pObj->fMarkB = 1; // mark the special node
-        }
-    }
-    Vec_PtrFree( vSuper );
+        Cnf_DeriveMappingNode( p, pObj, pAreaFlows );
     ABC_FREE( pAreaFlows );
 
 /*
@@ -150,6 +155,49 @@ void Cnf_DeriveMapping( Cnf_Man_t * p )
 */
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the mapping using several threads.]
+
+  Description [Computes the same mapping as Cnf_DeriveMapping(). The area 
+  flow of a node depends only on the area flows of the leaves of its cuts,
+  which are on the lower levels. So the nodes are visited level by level, 
+  the nodes of a large level are divided among the threads, and the result
+  does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cnf_MapPar_t_ Cnf_MapPar_t;
+struct Cnf_MapPar_t_
+{
+    Cnf_Man_t *      p;              // the CNF manager
+    int *            pAreaFlows;     // the area flows of the nodes
+    int *            pNodes;         // the nodes ordered by level
+};
+static void Cnf_DeriveMappingRange( void * pData, int iThread, int iBeg, int iEnd )
+{
+    Cnf_MapPar_t * pPar = (Cnf_MapPar_t *)pData;
+    int i;
+    for ( i = iBeg; i < iEnd; i++ )
+        Cnf_DeriveMappingNode( pPar->p, Aig_ManObj(pPar->p->pManAig, pPar->pNodes[i]), pPar->pAreaFlows );
+}
+void Cnf_DeriveMappingPar( Cnf_Man_t * p )
+{
+    Cnf_MapPar_t Par, * pPar = &Par;
+    Vec_Int_t * vNodes, * vStarts;
+    vNodes = Aig_ManLevelizeNodes( p->pManAig, &vStarts );
+    pPar->p          = p;
+    pPar->pAreaFlows = ABC_CALLOC( int, Aig_ManObjNumMax(p->pManAig) );
+    pPar->pNodes     = Vec_IntArray( vNodes );
+    Aig_ManLevelRunPar( vStarts, p->nThreads, AIG_LEVEL_PAR_MIN, Cnf_DeriveMappingRange, pPar );
+    ABC_FREE( pPar->pAreaFlows );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vStarts );
+}
+
 
 
 #if 0
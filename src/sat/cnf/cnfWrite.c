@@ -196,25 +196,137 @@ int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals )
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+static inline int Cnf_ManWriteClause( Cnf_Dat_t * pCnf, int *** ppClas, int ** ppLits, int * pBeg, int * pVarToPol, Cnf_ClauseFunc_t pFunc, void * pData )
+{
+    int * pLit, * pEnd = *ppLits;
+    if ( pFunc == NULL )
+    {
+        *(*ppClas)++ = pBeg;
+        return 1;
+    }
+    if ( pVarToPol )
+        for ( pLit = pBeg; pLit < pEnd; pLit++ )
+            *pLit ^= pVarToPol[Abc_Lit2Var(*pLit)];
+    *ppLits = pBeg;
+    return pFunc( pData, pCnf, pBeg, pEnd );
+}
+static inline int Cnf_ManWriteNode( Cnf_Man_t * p, Cnf_Dat_t * pCnf, Aig_Obj_t * pObj, Vec_Int_t * vSopTemp, int *** ppClas, int ** ppLits, int * pVarToPol, Cnf_ClauseFunc_t pFunc, void * pData )
+{
+    Cnf_Cut_t * pCut = Cnf_ObjBestCut( pObj );
+    Vec_Int_t * vCover;
+    int OutVar, pVars[32], * pLits = *ppLits, * pBeg;
+    unsigned uTruth;
+    int k, Cube;
+
+    // save variables of this cut
+    OutVar = pCnf->pVarNums[ pObj->Id ];
+    for ( k = 0; k < (int)pCut->nFanins; k++ )
+    {
+        pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
+        assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
+    }
+
+    // positive polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[1];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        pBeg = pLits;
+        *pLits++ = 2 * OutVar; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+        if ( !Cnf_ManWriteClause( pCnf, ppClas, &pLits, pBeg, pVarToPol, pFunc, pData ) )
+            return 0;
+    }
+
+    // negative polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[0];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        pBeg = pLits;
+        *pLits++ = 2 * OutVar + 1; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+        if ( !Cnf_ManWriteClause( pCnf, ppClas, &pLits, pBeg, pVarToPol, pFunc, pData ) )
+            return 0;
+    }
+    *ppLits = pLits;
+    return 1;
+}
+
+// the clauses of the nodes are written by several threads, each starting
+// at the known position in the clause array
+#define CNF_WRITE_PAR_MIN 1000 // the min number of nodes per thread
+
+typedef struct Cnf_WritePar_t_ Cnf_WritePar_t;
+struct Cnf_WritePar_t_
+{
+    Cnf_Man_t *      p;              // the CNF manager
+    Cnf_Dat_t *      pCnf;           // the CNF being written
+    Vec_Ptr_t *      vMapped;        // the mapped nodes
+    int              nTasks;         // the number of threads
+    int *            pLitsBeg;       // the first literal of each thread
+    int *            pClasBeg;       // the first clause of each thread
+};
+static void Cnf_ManWriteCnfRange( void * pData, int iThread, int iBeg, int iEnd )
+{
+    Cnf_WritePar_t * pPar = (Cnf_WritePar_t *)pData;
+    Vec_Int_t * vSopTemp = Vec_IntAlloc( 1 << 16 );
+    int * pLits = pPar->pCnf->pClauses[0] + pPar->pLitsBeg[iThread];
+    int ** pClas = pPar->pCnf->pClauses + pPar->pClasBeg[iThread];
+    int i;
+    assert( iBeg == Aig_RangeSplit(0, Vec_PtrSize(pPar->vMapped), iThread, pPar->nTasks) );
+    for ( i = iBeg; i < iEnd; i++ )
+        Cnf_ManWriteNode( pPar->p, pPar->pCnf, (Aig_Obj_t *)Vec_PtrEntry(pPar->vMapped, i), vSopTemp, &pClas, &pLits, NULL, NULL, NULL );
+    Vec_IntFree( vSopTemp );
+}
+static Cnf_Dat_t * Cnf_ManWriteCnfInt( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pData )
 {
     int fChangeVariableOrder = 0; // should be set to 0 to improve performance
     Aig_Obj_t * pObj;
     Cnf_Dat_t * pCnf;
     Cnf_Cut_t * pCut;
-    Vec_Int_t * vCover, * vSopTemp;
-    int OutVar, PoVar, pVars[32], * pLits, ** pClas;
+    Cnf_WritePar_t Par, * pPar = &Par;
+    Vec_Int_t * vSopTemp;
+    int OutVar, PoVar, pBuffer[40], * pLits, * pBeg, ** pClas = NULL, * pVarToPol = NULL;
     unsigned uTruth;
-    int i, k, nLiterals, nClauses, Cube, Number;
+    int i, t, nLiterals, nClauses, nLitsNodes, nClasNodes, Number, RetValue = 1, nTasks = 0;
+
+    // use several threads to write large CNF into the array
+    memset( pPar, 0, sizeof(Cnf_WritePar_t) );
+    if ( pFunc == NULL && p->nThreads > 1 && Vec_PtrSize(vMapped) >= CNF_WRITE_PAR_MIN * p->nThreads )
+    {
+        nTasks = p->nThreads;
+        pPar->pLitsBeg = ABC_ALLOC( int, nTasks );
+        pPar->pClasBeg = ABC_ALLOC( int, nTasks );
+    }
 
     // count the number of literals and clauses
-    nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
-    nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
+    nLiterals = nClauses = t = 0;
     Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
     {
         assert( Aig_ObjIsNode(pObj) );
         pCut = Cnf_ObjBestCut( pObj );
 
+        // remember where the task starts
+        if ( t < nTasks && i == Aig_RangeSplit(0, Vec_PtrSize(vMapped), t, nTasks) )
+        {
+            pPar->pLitsBeg[t] = nLiterals;
+            pPar->pClasBeg[t] = nClauses;
+            t++;
+        }
+
         // positive polarity of the cut
         if ( pCut->nFanins < 5 )
         {
@@ -244,15 +356,24 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
 //printf( "%d ", nClauses-(1 + Aig_ManCoNum( p->pManAig )) );
     }
 //printf( "\n" );
+    assert( t == nTasks );
+    nLitsNodes = nLiterals;
+    nClasNodes = nClauses;
+    // add the constant and the outputs
+    nLiterals += 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
+    nClauses += 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
 
     // allocate CNF
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
     pCnf->pMan = p->pManAig;
     pCnf->nLiterals = nLiterals;
     pCnf->nClauses = nClauses;
-    pCnf->pClauses = ABC_ALLOC( int *, nClauses + 1 );
-    pCnf->pClauses[0] = ABC_ALLOC( int, nLiterals );
-    pCnf->pClauses[nClauses] = pCnf->pClauses[0] + nLiterals;
+    if ( pFunc == NULL )
+    {
+        pCnf->pClauses = ABC_ALLOC( int *, nClauses + 1 );
+        pCnf->pClauses[0] = ABC_ALLOC( int, nLiterals );
+        pCnf->pClauses[nClauses] = pCnf->pClauses[0] + nLiterals;
+    }
     // create room for variable numbers
     pCnf->pVarNums = ABC_ALLOC( int, Aig_ManObjNumMax(p->pManAig) );
 //    memset( pCnf->pVarNums, 0xff, sizeof(int) * Aig_ManObjNumMax(p->pManAig) );
@@ -317,61 +438,51 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
         assert( Number >= 0 );
     }
 
+    // when streaming, polarity is changed as in Cnf_DataTranformPolarity()
+    if ( pFunc && fChangePol )
+    {
+        pVarToPol = ABC_CALLOC( int, pCnf->nVars );
+        Aig_ManForEachObj( p->pManAig, pObj, i )
+            if ( !Aig_ObjIsCo(pObj) && pCnf->pVarNums[pObj->Id] >= 0 )
+                pVarToPol[ pCnf->pVarNums[pObj->Id] ] = pObj->fPhase;
+    }
+
     // assign the clauses
     vSopTemp = Vec_IntAlloc( 1 << 16 );
-    pLits = pCnf->pClauses[0];
-    pClas = pCnf->pClauses;
-    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    if ( pFunc == NULL )
     {
-        pCut = Cnf_ObjBestCut( pObj );
-
-        // save variables of this cut
-        OutVar = pCnf->pVarNums[ pObj->Id ];
-        for ( k = 0; k < (int)pCut->nFanins; k++ )
-        {
-            pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
-            assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
-        }
-
-        // positive polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[1];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
-
-        // negative polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[0];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar + 1; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
+        pLits = pCnf->pClauses[0];
+        pClas = pCnf->pClauses;
+    }
+    else // clauses are written into the buffer one at a time
+        pLits = pBuffer;
+    if ( nTasks )
+    {
+        // one range divided among the threads
+        int pStarts[2] = { 0, Vec_PtrSize(vMapped) };
+        Vec_Int_t vStarts = { 2, 2, pStarts };
+        pPar->p       = p;
+        pPar->pCnf    = pCnf;
+        pPar->vMapped = vMapped;
+        pPar->nTasks  = nTasks;
+        Aig_ManLevelRunPar( &vStarts, nTasks, CNF_WRITE_PAR_MIN, Cnf_ManWriteCnfRange, pPar );
+        pLits = pCnf->pClauses[0] + nLitsNodes;
+        pClas = pCnf->pClauses + nClasNodes;
+    }
+    else
+    {
+        Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+            if ( !(RetValue = Cnf_ManWriteNode( p, pCnf, pObj, vSopTemp, &pClas, &pLits, pVarToPol, pFunc, pData )) )
+                goto finish;
     }
-    Vec_IntFree( vSopTemp );
  
     // write the constant literal
     OutVar = pCnf->pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
     assert( OutVar <= Aig_ManObjNumMax(p->pManAig) );
-    *pClas++ = pLits;
+    pBeg = pLits;
     *pLits++ = 2 * OutVar; 
+    if ( !(RetValue = Cnf_ManWriteClause( pCnf, &pClas, &pLits, pBeg, pVarToPol, pFunc, pData )) )
+        goto finish;
 
     // write the output literals
     Aig_ManForEachCo( p->pManAig, pObj, i )
@@ -379,29 +490,75 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
         OutVar = pCnf->pVarNums[ Aig_ObjFanin0(pObj)->Id ];
         if ( i < Aig_ManCoNum(p->pManAig) - nOutputs )
         {
-            *pClas++ = pLits;
+            pBeg = pLits;
             *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj); 
+            if ( !(RetValue = Cnf_ManWriteClause( pCnf, &pClas, &pLits, pBeg, pVarToPol, pFunc, pData )) )
+                goto finish;
         }
         else
         {
             PoVar = pCnf->pVarNums[ pObj->Id ];
             // first clause
-            *pClas++ = pLits;
+            pBeg = pLits;
             *pLits++ = 2 * PoVar; 
             *pLits++ = 2 * OutVar + !Aig_ObjFaninC0(pObj); 
+            if ( !(RetValue = Cnf_ManWriteClause( pCnf, &pClas, &pLits, pBeg, pVarToPol, pFunc, pData )) )
+                goto finish;
             // second clause
-            *pClas++ = pLits;
+            pBeg = pLits;
             *pLits++ = 2 * PoVar + 1; 
             *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj); 
+            if ( !(RetValue = Cnf_ManWriteClause( pCnf, &pClas, &pLits, pBeg, pVarToPol, pFunc, pData )) )
+                goto finish;
         }
     }
 
     // verify that the correct number of literals and clauses was written
-    assert( pLits - pCnf->pClauses[0] == nLiterals );
-    assert( pClas - pCnf->pClauses == nClauses );
+    if ( pFunc == NULL )
+    {
+        assert( pLits - pCnf->pClauses[0] == nLiterals );
+        assert( pClas - pCnf->pClauses == nClauses );
+    }
 //Cnf_DataPrint( pCnf, 1 );
+finish:
+    Vec_IntFree( vSopTemp );
+    ABC_FREE( pVarToPol );
+    ABC_FREE( pPar->pLitsBeg );
+    ABC_FREE( pPar->pClasBeg );
+    if ( RetValue == 0 )
+    {
+        Cnf_DataFree( pCnf );
+        return NULL;
+    }
     return pCnf;
 }
+Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+{
+    return Cnf_ManWriteCnfInt( p, vMapped, nOutputs, 0, NULL, NULL );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the mapping and streams it.]
+
+  Description [Instead of collecting the clauses in one array, passes
+  each of them to the callback as soon as it is derived. The clauses are
+  the same as those derived by Cnf_ManWriteCnf() after the optional change
+  of polarity by Cnf_DataTranformPolarity(). The returned CNF contains the
+  variable map and the counts but no clauses. Returns NULL if the callback
+  returned 0 (for example, when the solver found the problem trivially
+  unsatisfiable).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_ManWriteCnfStream( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pData )
+{
+    assert( pFunc != NULL );
+    return Cnf_ManWriteCnfInt( p, vMapped, nOutputs, fChangePol, pFunc, pData );
+}
 
 
 /**Function*************************************************************
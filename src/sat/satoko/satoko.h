@@ -142,6 +142,10 @@ extern void satoko_set_runid(satoko_t *, int);
 extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
 extern char satoko_var_polarity(satoko_t *, unsigned);
+/* Returns the literals assigned at the top level (the unit facts derived
+ * so far). The memory is managed by the solver and is valid until the next
+ * call to the solver. */
+extern int satoko_read_units(satoko_t *, int **);
 
 
 ABC_NAMESPACE_HEADER_END
@@ -674,4 +674,10 @@ char satoko_var_polarity(satoko_t *s, unsigned var)
     return vec_char_at(s->polarity, var);
 }
 
+int satoko_read_units(satoko_t *s, int **out)
+{
+    *out = (int *)vec_uint_data(s->trail);
+    return solver_dlevel(s) ? (int)vec_uint_at(s->trail_lim, 0) : (int)vec_uint_size(s->trail);
+}
+
 ABC_NAMESPACE_IMPL_END
@@ -1,9 +1,97 @@
 #include "gtest/gtest.h"
 
 #include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "sat/cnf/cnf.h"
+#include "base/main/main.h"
+
+ABC_NAMESPACE_HEADER_START
+extern void Cec_ManTransformClasses( Gia_Man_t * p );
+ABC_NAMESPACE_HEADER_END
 
 ABC_NAMESPACE_IMPL_START
 
+typedef int (*AppendNodeFunc)(Gia_Man_t* p, int i, int lit0, int lit1);
+
+static int AppendAnd(Gia_Man_t* p, int i, int lit0, int lit1) {
+  return Gia_ManAppendAnd(p, lit0, lit1);
+}
+
+// two structurally equal nodes; returns the first one
+static int AppendDuplicatedAnd(Gia_Man_t* p, int i, int lit0, int lit1) {
+  int lit = Gia_ManAppendAnd(p, lit0, lit1);
+  Gia_ManAppendAnd(p, lit1, lit0);
+  return lit;
+}
+
+static int AppendAndOrXor(Gia_Man_t* p, int i, int lit0, int lit1) {
+  return i % 7 ? Gia_ManAppendAnd(p, lit0, lit1) : Gia_ManAppendXorReal(p, lit0, lit1);
+}
+
+static int AppendAndXorOrBuf(Gia_Man_t* p, int i, int lit0, int lit1) {
+  if (i % 7 == 0)
+    return Gia_ManAppendXorReal(p, lit0, lit1);
+  if (i % 11 == 0)
+    return Gia_ManAppendBuf(p, lit0);
+  return Gia_ManAppendAnd(p, lit0, lit1);
+}
+
+// Appends the CIs and random nodes until the AIG has nNodes internal nodes.
+// The fanins are picked among all earlier signals or, when nSpan is given,
+// mostly among the last nSpan ones. Returns the literals of the CIs and of
+// the nodes created by pFuncAppend.
+static Vec_Int_t* AppendRandomAig(Gia_Man_t* p, int nCis, int nNodes, int nSpan = 0,
+                                  AppendNodeFunc pFuncAppend = AppendAnd) {
+  Vec_Int_t* lits = Vec_IntAlloc(nCis + nNodes);
+  for (int i = 0; i < nCis; i++)
+    Vec_IntPush(lits, Gia_ManAppendCi(p));
+  Abc_Random(1);
+  for (int i = 0; Gia_ManAndNum(p) < nNodes; i++) {
+    int span0 = nSpan && Abc_Random(0) % 8 ? Abc_MinInt(nSpan, Vec_IntSize(lits)) : Vec_IntSize(lits);
+    int span1 = nSpan && Abc_Random(0) % 8 ? Abc_MinInt(nSpan, Vec_IntSize(lits)) : Vec_IntSize(lits);
+    int lit0 = Vec_IntEntry(lits, Vec_IntSize(lits) - 1 - Abc_Random(0) % span0);
+    int lit1 = Vec_IntEntry(lits, Vec_IntSize(lits) - 1 - Abc_Random(0) % span1);
+    if (Abc_Lit2Var(lit0) == Abc_Lit2Var(lit1))
+      continue;
+    lit0 = Abc_LitNotCond(lit0, Abc_Random(0) & 1);
+    lit1 = Abc_LitNotCond(lit1, Abc_Random(0) & 1);
+    Vec_IntPush(lits, pFuncAppend(p, i, lit0, lit1));
+  }
+  return lits;
+}
+
+// Appends the random AIG with pairs of equivalent nodes computing a&(b&c)
+// and (a&b)&c, which are driving the COs. The last CO is complemented
+// when fFlipLast is set.
+static Gia_Man_t* BuildRedundantAig(int fFlipLast) {
+  Gia_Man_t* p = Gia_ManStart(5000);
+  Vec_Int_t* lits = AppendRandomAig(p, 16, 1000);
+  Vec_Int_t* outs = Vec_IntAlloc(100);
+  Gia_ManHashAlloc(p);
+  for (int i = 0; i < 50; i++) {
+    int a = Vec_IntEntry(lits, Abc_Random(0) % Vec_IntSize(lits));
+    int b = Vec_IntEntry(lits, Abc_Random(0) % Vec_IntSize(lits));
+    int c = Vec_IntEntry(lits, Abc_Random(0) % Vec_IntSize(lits));
+    Vec_IntPush(outs, Gia_ManHashAnd(p, a, Gia_ManHashAnd(p, b, c)));
+    Vec_IntPush(outs, Gia_ManHashAnd(p, Gia_ManHashAnd(p, a, b), c));
+  }
+  Gia_ManHashStop(p);
+  for (int i = 0; i < Vec_IntSize(outs); i++)
+    Gia_ManAppendCo(p, Abc_LitNotCond(Vec_IntEntry(outs, i), fFlipLast && i == Vec_IntSize(outs) - 1));
+  Vec_IntFree(outs);
+  Vec_IntFree(lits);
+  return p;
+}
+
+// Runs "&cec -F" on the implementation and the specification and returns its output.
+static std::string RunCecWithCache(const std::string& impl, const std::string& spec, const std::string& cache) {
+  std::string command = "&r " + impl + "; &cec -v -F " + cache + " " + spec;
+  testing::internal::CaptureStdout();
+  Cmd_CommandExecute(Abc_FrameGetGlobalFrame(), command.c_str());
+  fflush(stdout);
+  return testing::internal::GetCapturedStdout();
+}
+
 TEST(GiaTest, CanAllocateGiaManager) {
   Gia_Man_t* aig_manager =  Gia_ManStart(100);
 
@@ -51,4 +139,342 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, LevelSimulationMatchesSerial) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  Vec_Int_t* lits = AppendRandomAig(aig_manager, 16, 500, 0, AppendAndOrXor);
+  for (int i = Vec_IntSize(lits) - 10; i < Vec_IntSize(lits); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, i));
+  aig_manager->vSimsPi = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * 512);
+
+  Vec_Wrd_t* serial = Gia_ManSimPatSim(aig_manager);
+  Vec_Wrd_t* leveled = Gia_ManSimPatSimLevel(aig_manager, 3);
+
+  EXPECT_TRUE(Vec_WrdEqual(serial, leveled));
+  Vec_WrdFree(serial);
+  Vec_WrdFree(leveled);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, IsoClassesClearWholeReprs) {
+#ifdef ABC_USE_LARGE_GIA
+  EXPECT_EQ(sizeof(Gia_Obj_t), 16u);
+#else
+  EXPECT_EQ(sizeof(Gia_Obj_t), 12u);
+#endif
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  // each node is followed by its structural copy
+  Vec_Int_t* lits = AppendRandomAig(aig_manager, 8, 200, 0, AppendDuplicatedAnd);
+  int nObjs = Gia_ManObjNum(aig_manager);
+  aig_manager->pReprs = ABC_ALLOC(Gia_Rpr_t, nObjs);
+  aig_manager->pNexts = ABC_ALLOC(int, nObjs);
+  aig_manager->pIso = ABC_CALLOC(int, nObjs);
+  // the flags are set in every record and should be cleared
+  memset(aig_manager->pReprs, 0xFF, sizeof(Gia_Rpr_t) * nObjs);
+  Gia_Obj_t* pObj;
+  int i;
+  Gia_ManForEachAnd(aig_manager, pObj, i)
+    if (Gia_ObjFaninId0(pObj, i) == Gia_ObjFaninId0(Gia_ManObj(aig_manager, i - 1), i - 1) &&
+        Gia_ObjFaninId1(pObj, i) == Gia_ObjFaninId1(Gia_ManObj(aig_manager, i - 1), i - 1))
+      aig_manager->pIso[i] = i - 1;
+
+  Cec_ManTransformClasses(aig_manager);
+  for (i = 0; i < nObjs; i++) {
+    EXPECT_EQ(Gia_ObjRepr(aig_manager, i), aig_manager->pIso[i] ? aig_manager->pIso[i] : GIA_VOID);
+    EXPECT_FALSE(Gia_ObjProved(aig_manager, i));
+    EXPECT_FALSE(Gia_ObjFailed(aig_manager, i));
+    EXPECT_FALSE(Gia_ObjColors(aig_manager, i));
+  }
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, IndexedAigerMatchesPlain) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100000);
+  // more than one block of AND nodes with some long edges
+  Vec_Int_t* lits = AppendRandomAig(aig_manager, 64, 70000, 50);
+  for (int i = Vec_IntSize(lits) - 10; i < Vec_IntSize(lits); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, i));
+
+  std::string file_name = testing::TempDir() + "gia_indexed.aig";
+  Gia_AigerWriteSPar(aig_manager, (char*)file_name.c_str(), 0, 0, 0, 1, 3);
+  Gia_Man_t* parallel = Gia_AigerReadPar((char*)file_name.c_str(), 0, 1, 0, 3);
+  Gia_Man_t* serial = Gia_AigerRead((char*)file_name.c_str(), 0, 1, 0);
+  remove(file_name.c_str());
+
+  Vec_Str_t* original = Gia_AigerWriteIntoMemoryStr(aig_manager);
+  Vec_Str_t* from_parallel = Gia_AigerWriteIntoMemoryStr(parallel);
+  Vec_Str_t* from_serial = Gia_AigerWriteIntoMemoryStr(serial);
+  EXPECT_TRUE(Vec_StrEqual(original, from_parallel));
+  EXPECT_TRUE(Vec_StrEqual(original, from_serial));
+  Vec_StrFree(original);
+  Vec_StrFree(from_parallel);
+  Vec_StrFree(from_serial);
+  Gia_ManStop(parallel);
+  Gia_ManStop(serial);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ConcurrentRehashIsDeterministic) {
+  Gia_Man_t* aig_manager = Gia_ManStart(50000);
+  // duplicated nodes to be merged by strashing; most nodes are dangling
+  Vec_Int_t* lits = AppendRandomAig(aig_manager, 32, 30000, 0, AppendDuplicatedAnd);
+  for (int i = Vec_IntSize(lits) - 200; i < Vec_IntSize(lits); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, i));
+  // the CI added after the nodes
+  int lit = Gia_ManAppendAnd(aig_manager, Gia_ManAppendCi(aig_manager), Vec_IntEntry(lits, 100));
+  Gia_ManAppendCo(aig_manager, lit);
+
+  Gia_Man_t* serial = Gia_ManRehash(aig_manager, 0);
+  Gia_Man_t* one = Gia_ManRehashPar(aig_manager, 1);
+  Gia_Man_t* four = Gia_ManRehashPar(aig_manager, 4);
+
+  // the same AIG as produced by "&st"
+  Vec_Str_t* from_serial = Gia_AigerWriteIntoMemoryStr(serial);
+  Vec_Str_t* from_one = Gia_AigerWriteIntoMemoryStr(one);
+  Vec_Str_t* from_four = Gia_AigerWriteIntoMemoryStr(four);
+  EXPECT_EQ(Gia_ManAndNum(one), Gia_ManAndNum(serial));
+  EXPECT_TRUE(Vec_StrEqual(from_serial, from_one));
+  EXPECT_TRUE(Vec_StrEqual(from_serial, from_four));
+  Vec_StrFree(from_serial);
+  Vec_StrFree(from_one);
+  Vec_StrFree(from_four);
+  Gia_ManStop(serial);
+  Gia_ManStop(one);
+  Gia_ManStop(four);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, FaninLitsViewMatchesObjects) {
+  Gia_Man_t* aig_manager = Gia_ManStart(10000);
+  Vec_Int_t* lits = AppendRandomAig(aig_manager, 16, 4500, 0, AppendAndXorOrBuf);
+  for (int i = Vec_IntSize(lits) - 100; i < Vec_IntSize(lits); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, i));
+
+  int levels = Gia_ManLevelNum(aig_manager);
+  Vec_Int_t* levels_aos = Vec_IntDup(aig_manager->vLevels);
+  Gia_ManCreateRefs(aig_manager);
+  Vec_Int_t* refs_aos = Vec_IntAllocArrayCopy(aig_manager->pRefs, Gia_ManObjNum(aig_manager));
+  ABC_FREE(aig_manager->pRefs);
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * 2);
+  Vec_Wrd_t* sims_aos = Gia_ManSimPatSimOut(aig_manager, stimulus, 0);
+
+  Gia_ManFaninLitsStart(aig_manager);
+  EXPECT_TRUE(Gia_ManHasFaninLits(aig_manager));
+  EXPECT_EQ(Gia_ManLevelNum(aig_manager), levels);
+  EXPECT_TRUE(Vec_IntEqual(aig_manager->vLevels, levels_aos));
+  Gia_ManCreateRefs(aig_manager);
+  for (int i = 0; i < Gia_ManObjNum(aig_manager); i++)
+    EXPECT_EQ(aig_manager->pRefs[i], Vec_IntEntry(refs_aos, i));
+  Vec_Wrd_t* sims_soa = Gia_ManSimPatSimOut(aig_manager, stimulus, 0);
+  EXPECT_TRUE(Vec_WrdEqual(sims_aos, sims_soa));
+
+  // the view is kept in sync when the objects are appended or the COs are patched
+  int ci = Gia_ManAppendCi(aig_manager);
+  int lit_and = Gia_ManAppendAnd(aig_manager, Abc_LitNot(ci), Vec_IntEntry(lits, 30));
+  int lit_xor = Gia_ManAppendXorReal(aig_manager, lit_and, Vec_IntEntry(lits, 40));
+  int lit_buf = Gia_ManAppendBuf(aig_manager, Abc_LitNot(lit_xor));
+  Gia_ManAppendCo(aig_manager, lit_buf);
+  Gia_ManPatchCoDriver(aig_manager, Gia_ManCoNum(aig_manager) - 1, lit_and);
+  EXPECT_TRUE(Gia_ManHasFaninLits(aig_manager));
+  EXPECT_EQ(Vec_IntEntryLast(&aig_manager->vFanLits0), lit_and);
+  EXPECT_EQ(Vec_IntEntryLast(&aig_manager->vFanLits1), -1);
+  Vec_Int_t* fanins0 = Vec_IntDup(&aig_manager->vFanLits0);
+  Vec_Int_t* fanins1 = Vec_IntDup(&aig_manager->vFanLits1);
+  Gia_ManFaninLitsStop(aig_manager);
+  EXPECT_FALSE(Gia_ManHasFaninLits(aig_manager));
+  Gia_ManFaninLitsStart(aig_manager);
+  EXPECT_TRUE(Vec_IntEqual(fanins0, &aig_manager->vFanLits0));
+  EXPECT_TRUE(Vec_IntEqual(fanins1, &aig_manager->vFanLits1));
+  Gia_ManLevelNum(aig_manager);
+  Vec_Int_t* levels_soa = Vec_IntDup(aig_manager->vLevels);
+  Gia_ManFaninLitsStop(aig_manager);
+  Gia_ManLevelNum(aig_manager);
+  EXPECT_TRUE(Vec_IntEqual(aig_manager->vLevels, levels_soa));
+  Vec_IntFree(fanins0);
+  Vec_IntFree(fanins1);
+  Vec_IntFree(levels_soa);
+
+  Vec_WrdFree(stimulus);
+  Vec_WrdFree(sims_aos);
+  Vec_WrdFree(sims_soa);
+  Vec_IntFree(levels_aos);
+  Vec_IntFree(refs_aos);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, MemoryImageMatchesOriginal) {
+  Gia_Man_t* aig_manager = Gia_ManStart(10000);
+  Vec_Int_t* lits = AppendRandomAig(aig_manager, 16, 5000);
+  for (int i = Vec_IntSize(lits) - 10; i < Vec_IntSize(lits); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, i));
+  aig_manager->pName = Abc_UtilStrsav((char*)"image");
+
+  Gia_ManObj(aig_manager, 100)->fMark0 = 1;
+  Gia_ManObj(aig_manager, 200)->Value = 12345;
+
+  std::string file_name = testing::TempDir() + "gia_image.gim";
+  EXPECT_TRUE(Gia_ManImageWrite(aig_manager, (char*)file_name.c_str()));
+  EXPECT_TRUE(Gia_ManImageIsFile((char*)file_name.c_str()));
+  Gia_Man_t* attached = Gia_ManImageRead((char*)file_name.c_str(), 0, 1);
+  Gia_Man_t* through_reader = Gia_AigerRead((char*)file_name.c_str(), 0, 1, 0);
+  remove(file_name.c_str());
+  ASSERT_TRUE(attached != NULL);
+  ASSERT_TRUE(through_reader != NULL);
+  EXPECT_STREQ(attached->pName, "image");
+  // the user-controlled fields are not written
+  EXPECT_EQ(Gia_ManObj(attached, 100)->fMark0, 0u);
+  EXPECT_EQ(Gia_ManObj(attached, 200)->Value, 0u);
+
+  Vec_Str_t* original = Gia_AigerWriteIntoMemoryStr(aig_manager);
+  Vec_Str_t* from_image = Gia_AigerWriteIntoMemoryStr(attached);
+  Vec_Str_t* from_reader = Gia_AigerWriteIntoMemoryStr(through_reader);
+  EXPECT_TRUE(Vec_StrEqual(original, from_image));
+  EXPECT_TRUE(Vec_StrEqual(original, from_reader));
+  // the objects are moved into the heap when the image is extended
+  int lit = Gia_ManAppendAnd(attached, Vec_IntEntry(lits, 20), Vec_IntEntry(lits, 30));
+  Gia_ManAppendCo(attached, lit);
+  EXPECT_EQ(Gia_ManCoNum(attached), Gia_ManCoNum(aig_manager) + 1);
+  EXPECT_EQ(Gia_ObjFaninLit0p(attached, Gia_ManCo(attached, 10)), lit);
+  Vec_StrFree(original);
+  Vec_StrFree(from_image);
+  Vec_StrFree(from_reader);
+  Gia_ManStop(attached);
+  Gia_ManStop(through_reader);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, MemoryImageIsCheckedAndHashed) {
+  Gia_Man_t* aig_manager = Gia_ManStart(10000);
+  Vec_Int_t* lits = AppendRandomAig(aig_manager, 16, 2000, 0, AppendDuplicatedAnd);
+  for (int i = Vec_IntSize(lits) - 10; i < Vec_IntSize(lits); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, i));
+  Gia_Man_t* hashed = Gia_ManRehash(aig_manager, 0);
+  std::string file_name = testing::TempDir() + "gia_image_hash.gim";
+  char* name = (char*)file_name.c_str();
+
+  // the structural hashing is done as by the AIGER reader
+  ASSERT_TRUE(Gia_ManImageWrite(aig_manager, name));
+  Gia_Man_t* skipped = Gia_ManImageRead(name, 0, 1);
+  Gia_Man_t* strashed = Gia_ManImageRead(name, 0, 0);
+  ASSERT_TRUE(skipped != NULL);
+  ASSERT_TRUE(strashed != NULL);
+  EXPECT_EQ(Gia_ManAndNum(skipped), Gia_ManAndNum(aig_manager));
+  EXPECT_EQ(Gia_ManAndNum(strashed), Gia_ManAndNum(hashed));
+  EXPECT_LT(Gia_ManAndNum(strashed), Gia_ManAndNum(aig_manager));
+  Gia_ManStop(skipped);
+  Gia_ManStop(strashed);
+  // the hashed AIG is attached as it is
+  ASSERT_TRUE(Gia_ManImageWrite(hashed, name));
+  Gia_Man_t* attached = Gia_ManImageRead(name, 0, 0);
+  ASSERT_TRUE(attached != NULL);
+  EXPECT_TRUE(attached->pImage != NULL);
+  EXPECT_EQ(Gia_ManAndNum(attached), Gia_ManAndNum(hashed));
+  Gia_ManStop(attached);
+  ASSERT_TRUE(Gia_ManImageWrite(aig_manager, name));
+
+  // the fanin pointing forward is rejected
+  FILE* file = fopen(name, "r+b");
+  ASSERT_TRUE(file != NULL);
+  long offset = 64 + (long)sizeof(Gia_Obj_t) * (Gia_ManObjNum(aig_manager) - 1);
+  Gia_Obj_t obj;
+  fseek(file, offset, SEEK_SET);
+  ASSERT_EQ(fread(&obj, sizeof(Gia_Obj_t), 1, file), 1u);
+  obj.iDiff0 = Gia_ManObjNum(aig_manager);
+  fseek(file, offset, SEEK_SET);
+  ASSERT_EQ(fwrite(&obj, sizeof(Gia_Obj_t), 1, file), 1u);
+  fclose(file);
+  EXPECT_TRUE(Gia_ManImageRead(name, 0, 1) == NULL);
+
+  // the AIG with extensions is written in the AIGER format
+  aig_manager->vNamesIn = Vec_PtrAlloc(Gia_ManCiNum(aig_manager));
+  aig_manager->vNamesOut = Vec_PtrAlloc(Gia_ManCoNum(aig_manager));
+  for (int i = 0; i < Gia_ManCiNum(aig_manager); i++)
+    Vec_PtrPush(aig_manager->vNamesIn, Abc_UtilStrsav((char*)"in"));
+  for (int i = 0; i < Gia_ManCoNum(aig_manager); i++)
+    Vec_PtrPush(aig_manager->vNamesOut, Abc_UtilStrsav((char*)"out"));
+  EXPECT_TRUE(Gia_ManImageWrite(aig_manager, name));
+  EXPECT_FALSE(Gia_ManImageIsFile(name));
+  Gia_Man_t* with_names = Gia_AigerRead(name, 0, 1, 0);
+  remove(name);
+  ASSERT_TRUE(with_names != NULL);
+  ASSERT_TRUE(with_names->vNamesIn != NULL);
+  EXPECT_STREQ((char*)Vec_PtrEntry(with_names->vNamesIn, 0), "in");
+  Gia_ManStop(with_names);
+  Vec_IntFree(lits);
+  Gia_ManStop(hashed);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ParallelCnfMatchesSerial) {
+  Gia_Man_t* aig_manager = Gia_ManStart(50000);
+  Vec_Int_t* lits = AppendRandomAig(aig_manager, 64, 30000);
+  for (int i = Vec_IntSize(lits) - 500; i < Vec_IntSize(lits); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, i));
+  Aig_Man_t* aig = Gia_ManToAig(aig_manager, 0);
+
+  Cnf_Man_t* cnf_manager = Cnf_ManStart();
+  Cnf_Dat_t* serial = Cnf_DeriveWithMan(cnf_manager, aig, Aig_ManCoNum(aig));
+  cnf_manager->nThreads = 4;
+  Cnf_Dat_t* four = Cnf_DeriveWithMan(cnf_manager, aig, Aig_ManCoNum(aig));
+
+  ASSERT_EQ(serial->nVars, four->nVars);
+  ASSERT_EQ(serial->nClauses, four->nClauses);
+  ASSERT_EQ(serial->nLiterals, four->nLiterals);
+  EXPECT_EQ(0, memcmp(serial->pVarNums, four->pVarNums, sizeof(int) * Aig_ManObjNumMax(aig)));
+  EXPECT_EQ(0, memcmp(serial->pClauses[0], four->pClauses[0], sizeof(int) * serial->nLiterals));
+  for (int i = 0; i <= serial->nClauses; i++)
+    ASSERT_EQ(serial->pClauses[i] - serial->pClauses[0], four->pClauses[i] - four->pClauses[0]);
+
+  Cnf_DataFree(serial);
+  Cnf_DataFree(four);
+  Cnf_ManStop(cnf_manager);
+  Aig_ManStop(aig);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CecCacheKeepsVerdicts) {
+  Gia_Man_t* spec = BuildRedundantAig(0);
+  Gia_Man_t* good = Gia_ManCompress2(spec, 1, 0);
+  Gia_Man_t* bad = BuildRedundantAig(1);
+  std::string spec_name = testing::TempDir() + "cec_cache_spec.aig";
+  std::string good_name = testing::TempDir() + "cec_cache_good.aig";
+  std::string bad_name = testing::TempDir() + "cec_cache_bad.aig";
+  std::string cache_name = testing::TempDir() + "cec_cache.bin";
+  Gia_AigerWrite(spec, (char*)spec_name.c_str(), 0, 0, 0);
+  Gia_AigerWrite(good, (char*)good_name.c_str(), 0, 0, 0);
+  Gia_AigerWrite(bad, (char*)bad_name.c_str(), 0, 0, 0);
+  remove(cache_name.c_str());
+  Abc_Start();
+
+  // the first run proves the equivalences of the specification and saves them
+  std::string cold = RunCecWithCache(good_name, spec_name, cache_name);
+  EXPECT_NE(cold.find("does not exist yet"), std::string::npos);
+  EXPECT_NE(cold.find("Networks are equivalent"), std::string::npos);
+  EXPECT_EQ(cold.find("Saved 0 equivalences"), std::string::npos);
+  // the second run loads them and gives the same verdict
+  std::string warm = RunCecWithCache(good_name, spec_name, cache_name);
+  EXPECT_NE(warm.find("Loaded "), std::string::npos);
+  EXPECT_EQ(warm.find("Loaded 0 equivalences"), std::string::npos);
+  EXPECT_NE(warm.find("Networks are equivalent"), std::string::npos);
+  // the cached equivalences do not hide the difference
+  std::string wrong = RunCecWithCache(bad_name, spec_name, cache_name);
+  EXPECT_NE(wrong.find("Loaded "), std::string::npos);
+  EXPECT_NE(wrong.find("Networks are NOT EQUIVALENT"), std::string::npos);
+
+  Abc_Stop();
+  remove(spec_name.c_str());
+  remove(good_name.c_str());
+  remove(bad_name.c_str());
+  remove(cache_name.c_str());
+  Gia_ManStop(spec);
+  Gia_ManStop(good);
+  Gia_ManStop(bad);
+}
+
 ABC_NAMESPACE_IMPL_END